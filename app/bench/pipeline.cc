@@ -0,0 +1,212 @@
+#include <diags/streams.hpp>
+#include <lngs/internals/commands.hpp>
+#include <lngs/internals/diagnostics.hpp>
+#include <lngs/internals/gettext.hpp>
+#include <lngs/internals/languages.hpp>
+#include <lngs/internals/mstch_engine.hpp>
+#include <lngs/internals/strings.hpp>
+#include <lngs/internals/synth.hpp>
+#include <map>
+#include <memory>
+#include "bench.hpp"
+
+namespace lngs::app::bench {
+	using lngs::bench::allocations;
+
+	namespace {
+		constexpr auto source_name = "<synth>";
+
+		class null_outstream : public diags::outstream {
+		public:
+			std::size_t written{};
+			std::size_t write(const void*, std::size_t length) noexcept final {
+				written += length;
+				return length;
+			}
+		};
+
+		// Inputs and outputs of every stage for a given module size,
+		// generated once and shared between the benchmarks.
+		struct module_data {
+			std::string idl;
+			std::string po;
+			std::string mo;
+			idl_strings defs{};
+			std::map<std::string, std::string> messages{};
+			file lng{};
+
+			explicit module_data(std::size_t strings) {
+				synth::options opts{};
+				opts.strings = strings;
+				auto const synthetic = synth::make_strings(opts);
+				auto const lang = synth::find_language("pl");
+				idl = synth::make_idl(synthetic);
+				po = synth::make_po(synthetic, lang, opts.seed);
+				mo = synth::make_mo(synthetic, lang, opts.seed);
+
+				diags::sources diag;
+				diag.set_contents(source_name, idl);
+				app::read_strings(diag.source(source_name), defs, diag);
+
+				diag.set_contents(source_name, mo);
+				auto src = diag.source(source_name);
+				messages = gtt::open_mo(src, diag);
+				lng.serial = defs.serial;
+				lng.strings = app::translations(messages, defs.strings, false,
+				                                false, src, diag);
+				lng.attrs = attributes(messages);
+			}
+
+			static module_data const& get(std::size_t strings) {
+				static std::map<std::size_t, std::unique_ptr<module_data>>
+				    cache;
+				auto& data = cache[strings];
+				if (!data) data = std::make_unique<module_data>(strings);
+				return *data;
+			}
+		};
+
+		module_data const& setup(benchmark::State& state) {
+			auto const& data =
+			    module_data::get(static_cast<std::size_t>(state.range(0)));
+			if (data.defs.strings.size() !=
+			    static_cast<std::size_t>(state.range(0)))
+				state.SkipWithError("synthetic IDL could not be read");
+			return data;
+		}
+
+		void bytes_processed(benchmark::State& state, std::size_t size) {
+			state.SetBytesProcessed(static_cast<int64_t>(state.iterations()) *
+			                        static_cast<int64_t>(size));
+		}
+
+		void module_sizes(benchmark::internal::Benchmark* bench) {
+			bench->Arg(100)->Arg(1'000)->Arg(10'000)->Arg(200'000);
+			bench->Unit(benchmark::kMicrosecond);
+		}
+
+		struct env_data {
+			null_outstream output{};
+#ifdef LNGS_LINKED_RESOURCES
+			mstch_env env(idl_strings const& defs) noexcept {
+				return {output, defs};
+			}
+#else
+			std::optional<std::filesystem::path> redir{LNGS_BENCH_DATA_DIR};
+			mstch_env env(idl_strings const& defs) noexcept {
+				return {output, defs, redir};
+			}
+#endif
+		};
+	}  // namespace
+
+	void read_strings(benchmark::State& state) {
+		auto const& data = setup(state);
+		allocations allocs{};
+		for (auto _ : state) {
+			diags::sources diag;
+			diag.set_contents(source_name, data.idl);
+			idl_strings defs;
+			benchmark::DoNotOptimize(
+			    app::read_strings(diag.source(source_name), defs, diag));
+		}
+		allocs.report(state);
+		bytes_processed(state, data.idl.size());
+	}
+	// the IDL reader gets a 100k-string module on top of the usual sizes
+	BENCHMARK(read_strings)->Apply(module_sizes)->Arg(100'000);
+
+	void open_po(benchmark::State& state) {
+		auto const& data = setup(state);
+		allocations allocs{};
+		for (auto _ : state) {
+			diags::sources diag;
+			diag.set_contents(source_name, data.po);
+			auto src = diag.source(source_name);
+			benchmark::DoNotOptimize(gtt::open_po(src, diag));
+		}
+		allocs.report(state);
+		bytes_processed(state, data.po.size());
+	}
+	BENCHMARK(open_po)->Apply(module_sizes);
+
+	void open_mo(benchmark::State& state) {
+		auto const& data = setup(state);
+		allocations allocs{};
+		for (auto _ : state) {
+			diags::sources diag;
+			diag.set_contents(source_name, data.mo);
+			auto src = diag.source(source_name);
+			benchmark::DoNotOptimize(gtt::open_mo(src, diag));
+		}
+		allocs.report(state);
+		bytes_processed(state, data.mo.size());
+	}
+	BENCHMARK(open_mo)->Apply(module_sizes);
+
+	void translations(benchmark::State& state) {
+		auto const& data = setup(state);
+		diags::sources diag;
+		auto src = diag.source(source_name);
+		allocations allocs{};
+		for (auto _ : state) {
+			benchmark::DoNotOptimize(app::translations(
+			    data.messages, data.defs.strings, false, false, src, diag));
+		}
+		allocs.report(state);
+	}
+	BENCHMARK(translations)->Apply(module_sizes);
+
+	void file_write(benchmark::State& state) {
+		auto const& data = setup(state);
+		auto lng = data.lng;
+		null_outstream output{};
+		allocations allocs{};
+		for (auto _ : state) {
+			benchmark::DoNotOptimize(lng.write(output));
+		}
+		allocs.report(state);
+		state.SetBytesProcessed(static_cast<int64_t>(output.written));
+	}
+	BENCHMARK(file_write)->Apply(module_sizes);
+
+	void expand_context(benchmark::State& state) {
+		auto const& data = setup(state);
+		env_data out{};
+		auto const env = out.env(data.defs);
+		allocations allocs{};
+		for (auto _ : state) {
+			benchmark::DoNotOptimize(env.expand_context({}));
+		}
+		allocs.report(state);
+	}
+	BENCHMARK(expand_context)->Apply(module_sizes);
+
+	void render_enums(benchmark::State& state) {
+		auto const& data = setup(state);
+		env_data out{};
+		auto const env = out.env(data.defs);
+		allocations allocs{};
+		for (auto _ : state) {
+			benchmark::DoNotOptimize(enums::write(env, true));
+		}
+		allocs.report(state);
+		state.SetBytesProcessed(static_cast<int64_t>(out.output.written));
+	}
+	BENCHMARK(render_enums)->Apply(module_sizes);
+
+	void resource_table(benchmark::State& state) {
+		auto const& data = setup(state);
+		auto lng = data.lng;
+		std::size_t written{};
+		allocations allocs{};
+		for (auto _ : state) {
+			auto table = res::resource_table(lng);
+			written += table.size();
+			benchmark::DoNotOptimize(table);
+		}
+		allocs.report(state);
+		state.SetBytesProcessed(static_cast<int64_t>(written));
+	}
+	BENCHMARK(resource_table)->Apply(module_sizes);
+}  // namespace lngs::app::bench
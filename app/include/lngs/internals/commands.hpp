@@ -5,7 +5,9 @@
 
 #include <cstddef>
 #include <filesystem>
+#include <functional>
 #include <optional>
+#include <system_error>
 #include <tuple>
 #include <vector>
 
@@ -20,7 +22,14 @@ namespace lngs::app {
 	struct idl_strings;
 	struct mstch_env;
 
-	std::string straighten(std::string const& str);
+	std::string straighten(std::string_view str);
+
+	// Calls task(index) for every index below count on up to jobs threads
+	// (the number of processors, if zero); a thread, which is done with one
+	// task, takes the first one nobody started yet.
+	void parallel_for(std::size_t count,
+	                  unsigned jobs,
+	                  std::function<void(std::size_t)> const& task);
 }  // namespace lngs::app
 
 namespace lngs::app::pot {
@@ -36,7 +45,11 @@ namespace lngs::app::pot {
 }  // namespace lngs::app::pot
 
 namespace lngs::app::enums {
-	int write(mstch_env const& env, bool with_resource);
+	int write(mstch_env const& env,
+	          bool with_resource,
+	          bool static_resource = false,
+	          bool dense = false,
+	          bool with_keys = false);
 }
 
 namespace lngs::app::py {
@@ -53,15 +66,44 @@ namespace lngs::app::make {
 	                    diags::source_code& mo_file,
 	                    const std::string& ll_CCs,
 	                    diags::sources& diags);
+	void make_dense(file& file, const idl_strings& defs);
+
+	struct batch_item {
+		std::filesystem::path msgs;
+		std::filesystem::path lng;
+	};
+
+	// The .po and .mo files in msgs_dir, sorted by name, each with the .lng
+	// file to write in out_dir; of a .po and a .mo file with the same name,
+	// only the .mo file is used.
+	std::vector<batch_item> batch_items(std::filesystem::path const& msgs_dir,
+	                                    std::filesystem::path const& out_dir,
+	                                    std::error_code& ec);
 }  // namespace lngs::app::make
 
 namespace lngs::app::res {
+	struct plural_rule {
+		std::string culture;
+		std::string forms;
+		int nplurals{};
+		std::string expression;
+	};
+
 	file make_resource(const idl_strings& defs,
 	                   bool warp_strings,
 	                   bool with_keys);
+	std::string resource_table(file& data);
+	std::string string_literal(std::string_view str);
+	// The plural expression, if it may be compiled as C++ code with the same
+	// results the interpreter has; empty otherwise.
+	std::string plural_expression(std::string_view forms);
+	std::optional<plural_rule> native_plurals(diags::source_code data,
+	                                          diags::sources& diags);
 	int update_and_write(mstch_env const& env,
 	                     file& data,
-	                     std::string_view include);
+	                     std::string_view include,
+	                     bool static_table = false,
+	                     std::vector<plural_rule> const& plurals = {});
 }  // namespace lngs::app::res
 
 namespace lngs::app::freeze {
@@ -4,6 +4,7 @@
 #pragma once
 #include <lngs/lngs_base.hpp>
 #include <map>
+#include <optional>
 #include <vector>
 
 namespace diags {
@@ -23,6 +24,11 @@ namespace lngs::app {
 		}
 	};
 
+	struct tr_format {
+		uint32_t id{};
+		std::vector<format_segment> segments{};
+	};
+
 	struct idl_string;
 
 	std::string warp(const std::string& s);
@@ -37,6 +43,8 @@ namespace lngs::app {
 	    bool verbose,
 	    diags::source_code& src,
 	    diags::sources& diags);
+	std::vector<tr_format> format_templates(
+	    const std::vector<tr_string>& strings);
 	bool ll_CC(diags::source_code is,
 	           diags::sources& diags,
 	           std::map<std::string, std::string>& langs);
@@ -46,6 +54,10 @@ namespace lngs::app {
 		std::vector<tr_string> attrs{};
 		std::vector<tr_string> strings{};
 		std::vector<tr_string> keys{};
+		std::optional<std::vector<tr_format>> formats{};
+		// Number of strings in the definition file, for files, which have
+		// all of them in 'strs', sorted by id; zero for any other file.
+		uint32_t dense{0};
 
 		int write(diags::outstream& os);
 	};
@@ -46,12 +46,12 @@ namespace lngs::app {
 		std::optional<std::filesystem::path> m_additional_templates;
 	};
 
-	std::string straighten(std::string const& str);
+	std::string straighten(std::string_view str);
 
 	struct str_transform {
-		std::string (*value)(std::string const&) = straighten;
-		std::string (*help)(std::string const&) = straighten;
-		std::string (*plural)(std::string const&) = straighten;
+		std::string (*value)(std::string_view) = straighten;
+		std::string (*help)(std::string_view) = straighten;
+		std::string (*plural)(std::string_view) = straighten;
 		mstch::map from(idl_string const&) const;
 	};
 
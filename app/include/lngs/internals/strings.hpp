@@ -2,6 +2,10 @@
 // This code is licensed under MIT license (see LICENSE for details)
 
 #pragma once
+#include <filesystem>
+#include <memory>
+#include <memory_resource>
+#include <string_view>
 #include <vector>
 
 namespace diags {
@@ -10,24 +14,37 @@ namespace diags {
 }  // namespace diags
 
 namespace lngs::app {
+	// Owns the text the IDL definitions point to: a copy of the file, most
+	// of the fields are views of, and the strings, which had to be
+	// unescaped, joined from several literals or generated.
+	class idl_arena {
+	public:
+		std::string_view store(std::string_view text);
+
+	private:
+		std::pmr::monotonic_buffer_resource resource_{};
+	};
+
 	struct idl_string {
-		std::string key;
-		std::string value;
-		std::string help;
-		std::string plural;
+		std::string_view key;
+		std::string_view value;
+		std::string_view help;
+		std::string_view plural;
 		int id = -2;
 		int original_id = -2;
 		int id_offset = -1;
 	};
 
 	struct idl_strings {
-		std::string project;
-		std::string version;
-		std::string ns_name;
+		std::string_view project;
+		std::string_view version;
+		std::string_view ns_name;
 		uint32_t serial = 0;
 		int serial_offset = -1;
 		bool has_new = false;
 		std::vector<idl_string> strings;
+		// copies share the text
+		std::shared_ptr<idl_arena> arena{std::make_shared<idl_arena>()};
 	};
 
 	bool read_strings(diags::source_code in,
@@ -120,7 +120,7 @@ namespace lngs::app {
         ARGS_APP_OUT_LNG = 1055,
         /// sets IDL message file name to write results to; it may be the same as input; use "-" for standard output (Description for output argument for lngs freeze)
         ARGS_APP_OUT_IDL = 1056,
-        /// sets file name to wrtie results to; use "-" for standard output (Description for generic output argument)
+        /// sets file name to write results to; use "-" for standard output (Description for generic output argument)
         ARGS_APP_OUT_ANY = 1096,
         /// sets message file name to read from (Description for input argument taking IDL file)
         ARGS_APP_IN_IDL = 1057,
@@ -138,6 +138,54 @@ namespace lngs::app {
         ARGS_APP_IN_DEBUG = 1100,
         /// <template> (Name of argument holding a custom template name)
         ARGS_APP_META_MUSTACHE = 1101,
+        /// adds block of precompiled templates for strings with placeholders (Description for argument allowing for additional block of precompiled placeholder templates in resulting file)
+        ARGS_APP_WITH_FORMATS = 1102,
+        /// Generates message file with translations for scale testing. (Description for the synth command)
+        ARGS_APP_DESCR_CMD_SYNTH = 1103,
+        /// sets the directory to write generated files to (Description for output directory argument)
+        ARGS_APP_OUT_DIR = 1104,
+        /// <number> (Name of argument holding a number)
+        ARGS_APP_META_NUMBER = 1105,
+        /// <lang> (Name of argument holding a language code)
+        ARGS_APP_META_LANG = 1106,
+        /// sets the number of strings to generate; defaults to 1000 (Description for argument setting the number of generated strings)
+        ARGS_APP_SYNTH_COUNT = 1107,
+        /// sets the seed of the generator; the same seed always gives the same files (Description for argument setting the seed of the generator)
+        ARGS_APP_SYNTH_SEED = 1108,
+        /// sets the percentage of strings with plural forms; defaults to 10 (Description for argument setting the share of plural strings)
+        ARGS_APP_SYNTH_PLURALS = 1109,
+        /// sets the percentage of strings with help text; defaults to 80 (Description for argument setting the share of strings with help text)
+        ARGS_APP_SYNTH_HELPS = 1110,
+        /// sets the maximal length of generated keys; defaults to 32 (Description for argument setting the maximal length of generated keys)
+        ARGS_APP_SYNTH_KEY_LENGTH = 1111,
+        /// adds a language to generate PO and MO files for; may be repeated (Description for argument adding a language to generate translations for)
+        ARGS_APP_SYNTH_LANG = 1112,
+        /// instructs the Strings type to use the static table generated by the `lngs res --static'; implies --resource (Description for argument switching the Strings type to a static table generated by lngs res)
+        ARGS_APP_STATIC_RESOURCE = 1113,
+        /// writes strings as a static table, which needs no parsing at startup, instead of a binary resource (Description for argument writing the builtin strings as a static table instead of a binary resource)
+        ARGS_APP_STATIC_TABLE = 1114,
+        /// writes a string for every id of the message file, in the order expected by `lngs enums --dense' (Description for argument writing all strings in the order of their ids, for headers with string positions)
+        ARGS_APP_DENSE_FILE = 1115,
+        /// adds positions of the strings in files made by `lngs make --dense', so they are found without a search (Description for argument adding the position of each string in files made with lngs make --dense)
+        ARGS_APP_DENSE_SLOTS = 1116,
+        /// adds a map from keys to ids, which lets tr.get<"KEY">() find strings by key at compile time (Description for argument adding a compile-time map from string keys to their ids)
+        ARGS_APP_KEY_MAP = 1117,
+        /// compiles the Plural-Forms of the message file into a C++ function, used instead of parsing the rule at runtime; may be repeated (Description for argument compiling the Plural-Forms of a message file into the resource)
+        ARGS_APP_NATIVE_PLURALS = 1118,
+        /// builds one LNG file for every GetText message file in the directory, instead of the single file given by -m (Description for input argument taking a directory with GetText PO/MO files)
+        ARGS_APP_IN_MSGS_DIR = 1119,
+        /// sets the directory to write LNG files built from the --msgs-dir files to (Description for output directory argument for lngs make --msgs-dir)
+        ARGS_APP_OUT_LNG_DIR = 1120,
+        /// sets the number of message files built at the same time; defaults to the number of processors (Description for argument setting the number of threads)
+        ARGS_APP_JOBS = 1121,
+        /// arguments {0} and {1} cannot be used together (Error message for two arguments, which cannot be given together)
+        ARGS_APP_EXCLUSIVE = 1122,
+        /// Creates any of the header, resource, POT and Python files from message file at once. (Help description for the 'lngs gen' command)
+        ARGS_APP_DESCR_CMD_GEN = 1123,
+        /// writes builtin strings as a static table and instructs the Strings type to use it (Description for argument of lngs gen, which is both lngs res --static and lngs enums --static)
+        ARGS_APP_GEN_STATIC = 1124,
+        /// at least one of --enums, --res, --pot or --py is required (Error message for lngs gen called without any output file)
+        ARGS_APP_NO_OUTPUTS = 1125,
         /// note (Name of the severity label for notes.)
         SEVERITY_NOTE = 1060,
         /// warning (Name of the severity label for warnings.)
@@ -208,6 +256,10 @@ namespace lngs::app {
         ERR_GETTEXT_UNRECOGNIZED_FIELD = 1093,
         /// unrecognized escape sequence `\{0}' (The PO file has unexpected string contents)
         ERR_GETTEXT_UNRECOGNIZED_ESCAPE = 1094,
+        /// Plural-Forms of this file cannot be compiled; the rule will be interpreted at runtime (The Plural-Forms of a message file given to lngs res --plurals was missing, or could not be turned into C++ code)
+        ERR_PLURALS_NOT_NATIVE = 1126,
+        /// no GetText message files in `{0}' (The directory given to lngs make --msgs-dir has no .po or .mo files; the directory name is going to be shown as argument {0}.)
+        ERR_NO_MSGS_FILES = 1127,
     }; // enum class lng
 
     struct Resource {
@@ -0,0 +1,42 @@
+// Copyright (c) 2026 midnightBITS
+// This code is licensed under MIT license (see LICENSE for details)
+
+#pragma once
+#include <cstdint>
+#include <filesystem>
+#include <lngs/internals/strings.hpp>
+#include <string>
+#include <string_view>
+#include <vector>
+
+namespace lngs::app::synth {
+	struct options {
+		uint64_t seed{0};
+		std::size_t strings{1000};
+		unsigned plurals{10};     // percent of strings with plural forms
+		unsigned helps{80};       // percent of strings with help text
+		unsigned key_length{32};  // longest key to generate
+	};
+
+	struct language {
+		std::string_view code;
+		unsigned nplurals;
+		std::string_view plural_forms;
+	};
+
+	// Languages with their gettext Plural-Forms; any other code gets the
+	// rule used by English.
+	std::vector<language> const& known_languages();
+	language find_language(std::string_view code);
+
+	// Everything produced here depends only on the arguments, so the same
+	// seed always gives the same files.
+	idl_strings make_strings(options const& opts);
+	std::string make_idl(idl_strings const& defs);
+	std::string make_po(idl_strings const& defs,
+	                    language const& lang,
+	                    uint64_t seed);
+	std::string make_mo(idl_strings const& defs,
+	                    language const& lang,
+	                    uint64_t seed);
+}  // namespace lngs::app::synth
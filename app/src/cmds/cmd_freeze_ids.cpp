@@ -15,9 +15,9 @@ namespace lngs::app::freeze {
 		++defs.serial;
 
 		for (auto& s : defs.strings) {
-			s.value.clear();
-			s.help.clear();
-			s.plural.clear();
+			s.value = {};
+			s.help = {};
+			s.plural = {};
 		}
 
 		sort(begin(defs.strings), end(defs.strings),
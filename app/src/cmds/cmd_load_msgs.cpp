@@ -73,4 +73,32 @@ namespace lngs::app::make {
 		     [](auto& lhs, auto& rhs) { return lhs.key.id < rhs.key.id; });
 		return true;
 	}
+
+	void make_dense(file& file, const idl_strings& defs) {
+		std::vector<uint32_t> ids;
+		ids.reserve(defs.strings.size());
+		for (auto& str : defs.strings)
+			ids.push_back(static_cast<uint32_t>(str.id));
+		sort(begin(ids), end(ids));
+
+		auto const by_id = [](auto& lhs, auto& rhs) {
+			return lhs.key.id < rhs.key.id;
+		};
+		sort(begin(file.strings), end(file.strings), by_id);
+
+		std::vector<tr_string> strings;
+		strings.reserve(ids.size());
+		auto it = begin(file.strings);
+		for (auto id : ids) {
+			while (it != end(file.strings) && it->key.id < id)
+				++it;
+			if (it != end(file.strings) && it->key.id == id)
+				strings.push_back(std::move(*it++));
+			else
+				strings.emplace_back(id, std::string{});
+		}
+
+		file.strings = std::move(strings);
+		file.dense = static_cast<uint32_t>(ids.size());
+	}
 }  // namespace lngs::app::make
@@ -0,0 +1,38 @@
+// Copyright (c) 2026 midnightBITS
+// This code is licensed under MIT license (see LICENSE for details)
+
+#include <lngs/internals/commands.hpp>
+
+#include <algorithm>
+
+namespace lngs::app::make {
+	std::vector<batch_item> batch_items(std::filesystem::path const& msgs_dir,
+	                                    std::filesystem::path const& out_dir,
+	                                    std::error_code& ec) {
+		std::vector<batch_item> items;
+		for (auto const& entry :
+		     std::filesystem::directory_iterator{msgs_dir, ec}) {
+			if (!entry.is_regular_file(ec)) continue;
+			auto const& path = entry.path();
+			auto const ext = path.extension();
+			if (ext != ".po" && ext != ".mo") continue;
+
+			auto lng = out_dir / path.filename();
+			lng.replace_extension(".lng");
+			items.push_back({path, std::move(lng)});
+		}
+		if (ec) return {};
+
+		sort(begin(items), end(items), [](auto const& lhs, auto const& rhs) {
+			if (lhs.lng != rhs.lng) return lhs.lng < rhs.lng;
+			// ".mo" < ".po"
+			return lhs.msgs.extension() < rhs.msgs.extension();
+		});
+		items.erase(unique(begin(items), end(items),
+		                   [](auto const& lhs, auto const& rhs) {
+			                   return lhs.lng == rhs.lng;
+		                   }),
+		            end(items));
+		return items;
+	}
+}  // namespace lngs::app::make
@@ -3,9 +3,72 @@
 
 #include <lngs/internals/commands.hpp>
 #include <lngs/internals/mstch_engine.hpp>
+#include <lngs/internals/strings.hpp>
+
+#include <algorithm>
 
 namespace lngs::app::enums {
-	int write(mstch_env const& env, bool with_resource) {
-		return env.write_mstch("enums", {{"with_resource", with_resource}});
+	namespace {
+		// Slot of every id from the lowest to the highest one, in the order
+		// "lngs make --dense" writes the strings in; ids between them, which
+		// are not in the definition file, get no slot.
+		mstch::map slots_context(idl_strings const& defs) {
+			std::vector<uint32_t> ids;
+			ids.reserve(defs.strings.size());
+			for (auto& str : defs.strings)
+				ids.push_back(static_cast<uint32_t>(str.id));
+			sort(begin(ids), end(ids));
+
+			mstch::array slots;
+			uint32_t slot = 0;
+			for (auto id = ids.front(); id <= ids.back(); ++id) {
+				auto const known = ids[slot] == id;
+				slots.push_back(mstch::map{
+				    {"id", std::to_string(id)},
+				    {"slot", known ? std::to_string(slot++)
+				                   : std::string{"lngs::no_slot"}}});
+			}
+
+			return {{"dense", true},
+			        {"first_id", std::to_string(ids.front())},
+			        {"slots", std::move(slots)}};
+		}
+
+		// Keys of the singular and the plural strings, each sorted for the
+		// binary search in lngs::id_of().
+		void keys_context(mstch::map& ctx, idl_strings const& defs) {
+			std::vector<std::string_view> singular, plural;
+			for (auto& str : defs.strings)
+				(str.plural.empty() ? singular : plural).push_back(str.key);
+			sort(begin(singular), end(singular));
+			sort(begin(plural), end(plural));
+
+			auto const to_array = [](auto const& keys) {
+				mstch::array result;
+				result.reserve(keys.size());
+				for (auto key : keys)
+					result.push_back(mstch::map{{"key", std::string{key}}});
+				return result;
+			};
+
+			ctx["with_keys"] = true;
+			ctx["singular_keys"] = to_array(singular);
+			ctx["plural_keys"] = to_array(plural);
+		}
+	}  // namespace
+
+	int write(mstch_env const& env,
+	          bool with_resource,
+	          bool static_resource,
+	          bool dense,
+	          bool with_keys) {
+		mstch::map ctx{};
+		if (dense && !env.defs.strings.empty())
+			ctx = slots_context(env.defs);
+		if (with_keys && !env.defs.strings.empty())
+			keys_context(ctx, env.defs);
+		ctx["with_resource"] = with_resource || static_resource;
+		ctx["static_resource"] = static_resource;
+		return env.write_mstch("enums", std::move(ctx));
 	}
 }  // namespace lngs::app::enums
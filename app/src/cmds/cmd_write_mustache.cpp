@@ -13,7 +13,7 @@ using namespace std::literals;
 
 namespace lngs::app::mustache {
 	namespace {
-		std::string escape(const std::string& in) {
+		std::string escape(std::string_view in) {
 			std::string out;
 			out.reserve(in.length() * 11 / 10);
 			for (auto c : in) {
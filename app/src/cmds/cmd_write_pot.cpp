@@ -10,8 +10,8 @@
 #include <lngs/internals/mstch_engine.hpp>
 
 namespace lngs::app {
-	std::string straighten(std::string const& input) {
-		auto str = input;
+	std::string straighten(std::string_view input) {
+		std::string str{input};
 		for (auto& c : str)
 			if (c == '\n') c = ' ';
 		return str;
@@ -44,7 +44,7 @@ namespace lngs::app::pot {
 		return buffer;
 	}
 
-	std::string escape(const std::string& in) {
+	std::string escape(std::string_view in) {
 		std::string out;
 		out.reserve(in.length() * 11 / 10);
 		for (auto c : in) {
@@ -1,10 +1,15 @@
 // Copyright (c) 2015 midnightBITS
 // This code is licensed under MIT license (see LICENSE for details)
 
+#include <algorithm>
+#include <cctype>
 #include <diags/streams.hpp>
 #include <lngs/internals/commands.hpp>
+#include <lngs/internals/diagnostics.hpp>
+#include <lngs/internals/gettext.hpp>
 #include <lngs/internals/languages.hpp>
 #include <lngs/internals/mstch_engine.hpp>
+#include <lngs/plurals.hpp>
 
 namespace lngs::app::res {
 	class table_outstream : public diags::outstream {
@@ -54,18 +59,19 @@ namespace lngs::app::res {
 		bool has_plurals = false;
 		for (auto& string : defs.strings) {
 			if (!string.plural.empty()) has_plurals = true;
-			auto value = string.value;
+			std::string value{string.value};
 			if (warp_strings) value = warp(value);
 
 			if (!string.plural.empty()) {
 				value.push_back(0);
 				if (warp_strings)
-					value.append(warp(string.plural));
+					value.append(warp(std::string{string.plural}));
 				else
 					value.append(string.plural);
 			}
 
-			if (with_keys) file.keys.emplace_back(string.id, string.key);
+			if (with_keys)
+				file.keys.emplace_back(string.id, std::string{string.key});
 			file.strings.emplace_back(string.id, value);
 		}
 		if (has_plurals)
@@ -74,15 +80,236 @@ namespace lngs::app::res {
 		return file;
 	}
 
+	std::string resource_table(file& data) {
+		table_outstream os{};
+		data.write(os);
+		return os.finalize();
+	}
+
+	// {"...", length}, to initialize a std::string_view, which may have
+	// NULs inside; all non-ASCII bytes are octal escapes, which, unlike \x,
+	// cannot swallow the next character
+	std::string string_literal(std::string_view str) {
+		std::string out;
+		out.reserve(str.size() + 16);
+		out.append("{\"");
+		for (auto c : str) {
+			auto const uc = static_cast<unsigned char>(c);
+			switch (c) {
+				case '\\':
+					out.append("\\\\");
+					break;
+				case '\"':
+					out.append("\\\"");
+					break;
+				case '\n':
+					out.append("\\n");
+					break;
+				case '\t':
+					out.append("\\t");
+					break;
+				default:
+					if (uc < 0x20 || uc > 0x7e)
+						out.append(fmt::format("\\{:03o}", uc));
+					else
+						out.push_back(c);
+			}
+		}
+		out.append("\", ");
+		out.append(std::to_string(str.size()));
+		out.push_back('}');
+		return out;
+	}
+
+	namespace {
+		std::string_view trim(std::string_view value) {
+			auto const space = [](char c) {
+				return std::isspace(static_cast<unsigned char>(c));
+			};
+			while (!value.empty() && space(value.front()))
+				value.remove_prefix(1);
+			while (!value.empty() && space(value.back()))
+				value.remove_suffix(1);
+			return value;
+		}
+
+		std::string_view forms_field(std::string_view forms,
+		                             std::string_view name) {
+			while (!forms.empty()) {
+				auto const end = forms.find(';');
+				auto item = forms.substr(0, end);
+				forms = end == std::string_view::npos ? std::string_view{}
+				                                      : forms.substr(end + 1);
+				auto const eq = item.find('=');
+				if (eq == std::string_view::npos) continue;
+				if (trim(item.substr(0, eq)) == name)
+					return trim(item.substr(eq + 1));
+			}
+			return {};
+		}
+
+		// Only n, numbers and operators; a number is decimal and fits in
+		// intmax_t, and division by anything else than a number other than
+		// zero is left to the interpreter, which does not crash on it.
+		bool safe_expression(std::string_view expr) {
+			static constexpr std::string_view allowed =
+			    "n0123456789 \t()?:!<>=&|%/*+-";
+			if (expr.find_first_not_of(allowed) != std::string_view::npos)
+				return false;
+
+			auto const is_digit = [](char c) { return c >= '0' && c <= '9'; };
+			for (size_t pos = 0; pos < expr.size(); ++pos) {
+				auto const c = expr[pos];
+				if (is_digit(c)) {
+					auto const start = pos;
+					while (pos < expr.size() && is_digit(expr[pos]))
+						++pos;
+					auto const length = pos - start;
+					if (length > 18 || (length > 1 && c == '0')) return false;
+					--pos;
+					continue;
+				}
+
+				if (c != '/' && c != '%') continue;
+				auto next = expr.find_first_not_of(" \t", pos + 1);
+				if (next == std::string_view::npos || !is_digit(expr[next]))
+					return false;
+				if (expr[next] == '0') return false;
+			}
+			return true;
+		}
+
+		std::string function_name(std::string_view culture) {
+			std::string name{"plural_"};
+			for (auto c : culture) {
+				auto const uc = static_cast<unsigned char>(c);
+				name.push_back(std::isalnum(uc) ? c : '_');
+			}
+			return name;
+		}
+
+		mstch::array plurals_context(std::vector<plural_rule> const& rules) {
+			mstch::array result;
+			result.reserve(rules.size());
+			std::vector<std::string> names;
+			for (auto const& rule : rules) {
+				auto name = function_name(rule.culture);
+				auto const base = name;
+				for (int index = 2; std::find(names.begin(), names.end(),
+				                              name) != names.end();
+				     ++index)
+					name = base + "_" + std::to_string(index);
+				names.push_back(name);
+
+				result.push_back(mstch::map{
+				    {"name", name},
+				    {"culture", string_literal(rule.culture)},
+				    {"forms", string_literal(rule.forms)},
+				    {"nplurals", std::to_string(rule.nplurals)},
+				    {"expression", rule.expression}});
+			}
+			return result;
+		}
+
+		mstch::map table_context(file const& data) {
+			struct entry {
+				uint32_t id;
+				std::string_view value;
+				std::string_view key;
+			};
+
+			std::vector<entry> entries;
+			entries.reserve(data.strings.size());
+			for (auto const& str : data.strings)
+				entries.push_back({str.key.id, str.value, {}});
+			std::sort(entries.begin(), entries.end(),
+			          [](auto const& lhs, auto const& rhs) {
+				          return lhs.id < rhs.id;
+			          });
+
+			for (auto const& key : data.keys) {
+				auto it = std::lower_bound(
+				    entries.begin(), entries.end(), key.key.id,
+				    [](auto const& item, uint32_t id) { return item.id < id; });
+				if (it != entries.end() && it->id == key.key.id)
+					it->key = key.value;
+			}
+
+			std::string_view plurals{};
+			for (auto const& attr : data.attrs) {
+				if (attr.key.id == ATTR_PLURALS) plurals = attr.value;
+			}
+
+			mstch::array table;
+			table.reserve(entries.size());
+			for (auto const& item : entries) {
+				table.push_back(
+				    mstch::map{{"id", std::to_string(item.id)},
+				               {"value", string_literal(item.value)},
+				               {"key", string_literal(item.key)}});
+			}
+
+			auto const with_keys = !data.keys.empty();
+			return {{"static_table", true},
+			        {"with_table", !entries.empty()},
+			        {"with_table_keys", with_keys},
+			        {"table_keys", std::string{with_keys ? "keys" : "nullptr"}},
+			        {"table_count", std::to_string(entries.size())},
+			        {"table_plurals", string_literal(plurals)},
+			        {"table", std::move(table)}};
+		}
+	}  // namespace
+
+	std::string plural_expression(std::string_view forms) {
+		auto const lex = plurals::decode(forms);
+		if (!lex.plural || lex.nplurals < 1) return {};
+
+		auto const expr = forms_field(forms, "plural");
+		if (!safe_expression(expr)) return {};
+		return std::string{expr};
+	}
+
+	std::optional<plural_rule> native_plurals(diags::source_code data,
+	                                          diags::sources& diags) {
+		auto const map = gtt::is_mo(data) ? gtt::open_mo(data, diags)
+		                                  : gtt::open_po(data, diags);
+
+		plural_rule rule{};
+		for (auto const& attr : attributes(map)) {
+			if (attr.key.id == ATTR_CULTURE) rule.culture = attr.value;
+			if (attr.key.id == ATTR_PLURALS) rule.forms = attr.value;
+		}
+
+		if (!rule.culture.empty() && !rule.forms.empty()) {
+			rule.expression = plural_expression(rule.forms);
+			rule.nplurals = plurals::decode(rule.forms).nplurals;
+		}
+
+		if (rule.expression.empty()) {
+			diags.push_back(data.position()[diags::severity::warning]
+			                << lng::ERR_PLURALS_NOT_NATIVE);
+			return std::nullopt;
+		}
+		return rule;
+	}
+
 	int update_and_write(mstch_env const& env,
 	                     file& data,
-	                     std::string_view include) {
-		auto resource = mstch::lambda{[&]() -> mstch::node {
-			table_outstream os{};
-			data.write(os);
-			return os.finalize();
-		}};
-		return env.write_mstch(
-		    "res", {{"include", std::string{include}}, {"resource", resource}});
+	                     std::string_view include,
+	                     bool static_table,
+	                     std::vector<plural_rule> const& plurals) {
+		mstch::map ctx{};
+		if (static_table) {
+			ctx = table_context(data);
+		} else {
+			ctx["resource"] = mstch::lambda{
+			    [&]() -> mstch::node { return resource_table(data); }};
+		}
+		ctx["include"] = std::string{include};
+		if (!plurals.empty()) {
+			ctx["with_plurals"] = true;
+			ctx["plural_rules"] = plurals_context(plurals);
+		}
+		return env.write_mstch("res", std::move(ctx));
 	}
 }  // namespace lngs::app::res
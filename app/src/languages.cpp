@@ -7,6 +7,7 @@
 #include <lngs/internals/diagnostics.hpp>
 #include <lngs/internals/languages.hpp>
 #include <lngs/internals/strings.hpp>
+#include <lngs/lngs_file.hpp>
 #include <utf/utf.hpp>
 
 namespace lngs::app {
@@ -129,15 +130,18 @@ namespace lngs::app {
 		std::vector<tr_string> out;
 		out.reserve(gtt.empty() ? 0 : gtt.size() - 1);
 
+		std::string key;
 		for (auto& str : strings) {
-			auto it = gtt.find(str.key);
+			key.assign(str.key);
+			auto it = gtt.find(key);
 			if (it == gtt.end()) {
 				if (verbose) {
 					diags.push_back(
 					    src.position()[diags::severity::warning]
-					    << format(lng::ERR_MSGS_TRANSLATION_MISSING, str.key));
+					    << format(lng::ERR_MSGS_TRANSLATION_MISSING, key));
 				}
-				if (warp_missing) out.emplace_back(str.id, warp(str.value));
+				if (warp_missing)
+					out.emplace_back(str.id, warp(std::string{str.value}));
 				continue;
 			}
 			out.emplace_back(str.id, it->second);
@@ -146,6 +150,23 @@ namespace lngs::app {
 		return out;
 	}
 
+	std::vector<tr_format> format_templates(
+	    const std::vector<tr_string>& strings) {
+		std::vector<tr_format> out;
+
+		for (auto& str : strings) {
+			// no braces means nothing to substitute or unescape; the runtime
+			// can copy such strings as they are
+			if (str.value.find_first_of("{}") == std::string::npos) continue;
+
+			tr_format tmplt{str.key.id};
+			if (!compile_format(str.value, tmplt.segments)) continue;
+			out.push_back(std::move(tmplt));
+		}
+
+		return out;
+	}
+
 	std::map<std::string, std::string, std::less<>> attrGTT(
 	    std::string_view attrs) {
 		std::map<std::string, std::string, std::less<>> out;
@@ -395,6 +416,46 @@ namespace lngs::app {
 
 			return 0;
 		}
+
+		int section(diags::outstream& os,
+		            uint32_t section_id,
+		            std::vector<tr_format> const& block) {
+			constexpr auto words = [](auto size) {
+				return static_cast<uint32_t>(size / sizeof(uint32_t));
+			};
+
+			string_header hdr;
+			hdr.id = section_id;
+			hdr.string_offset = words(sizeof(string_header)) +
+			                    words(sizeof(string_key)) *
+			                        static_cast<uint32_t>(block.size());
+			hdr.ints = hdr.string_offset - words(sizeof(section_header));
+			hdr.string_count = static_cast<uint32_t>(block.size());
+
+			uint32_t segments = 0;
+			for (auto& tmplt : block)
+				segments += static_cast<uint32_t>(tmplt.segments.size());
+			hdr.ints += segments * words(sizeof(format_segment));
+
+			WRITE(os, hdr);
+
+			uint32_t offset = 0;
+			for (auto& tmplt : block) {
+				string_key key;
+				key.id = tmplt.id;
+				key.offset = offset;
+				key.length = static_cast<uint32_t>(tmplt.segments.size());
+				offset += key.length;
+				WRITE(os, key);
+			}
+
+			for (auto& tmplt : block) {
+				for (auto& segment : tmplt.segments)
+					WRITE(os, segment);
+			}
+
+			return 0;
+		}
 	}  // namespace
 
 	int file::write(diags::outstream& os) {
@@ -416,6 +477,12 @@ namespace lngs::app {
 		CARRY(section(os, attrtext_tag, attrs));
 		CARRY(section(os, strstext_tag, strings));
 		CARRY(section(os, keystext_tag, keys));
+		if (formats) CARRY(section(os, fmtstext_tag, *formats));
+		if (dense) {
+			WRITE(os, denstext_tag);
+			WRITE(os, static_cast<uint32_t>(1));
+			WRITE(os, dense);
+		}
 
 #ifdef _MSC_VER
 #pragma warning(pop)
@@ -1,6 +1,7 @@
 // Copyright (c) 2015 midnightBITS
 // This code is licensed under MIT license (see LICENSE for details)
 
+#include <algorithm>
 #include <args/parser.hpp>
 #include <diags/translator.hpp>
 #include <lngs/internals/commands.hpp>
@@ -8,6 +9,7 @@
 #include <lngs/internals/languages.hpp>
 #include <lngs/internals/mstch_engine.hpp>
 #include <lngs/internals/strings.hpp>
+#include <lngs/internals/synth.hpp>
 #include <lngs/translation.hpp>
 #ifndef LNGS_ZERO
 #include "build.hpp"
@@ -74,16 +76,29 @@ namespace lngs::app {
 		void setup_parser(args::parser& parser,
 		                  lng inname_usage,
 		                  lng outname_usage,
-		                  Translator _) {
-			parser.provide_help(false);
-			auto show_help = +[](args::parser& p) { p.help(); };
-
+		                  Translator _,
+		                  bool outname_required = true) {
 			parser.arg(inname)
 			    .meta(_(lng::ARGS_APP_META_INPUT))
 			    .help(_(inname_usage));
-			parser.arg(outname, "o")
-			    .meta(_(lng::ARGS_APP_META_FILE))
-			    .help(_(outname_usage));
+			if (outname_required) {
+				parser.arg(outname, "o")
+				    .meta(_(lng::ARGS_APP_META_FILE))
+				    .help(_(outname_usage));
+			} else {
+				parser.arg(outname, "o")
+				    .meta(_(lng::ARGS_APP_META_FILE))
+				    .help(_(outname_usage))
+				    .opt();
+			}
+			setup_options(parser, _);
+		}
+
+		template <typename Translator>
+		void setup_options(args::parser& parser, Translator _) {
+			parser.provide_help(false);
+			auto show_help = +[](args::parser& p) { p.help(); };
+
 			parser.custom(show_help, "h", "help")
 			    .help(_(lng::ARGS_HELP_DESCRIPTION))
 			    .opt();
@@ -109,15 +124,27 @@ namespace lngs::app {
 
 		~setup_base() { diag.print_diagnostics(); }
 
-		void parser_common(lng inname_usage, lng outname_usage) {
-			common.setup_parser(parser, inname_usage, outname_usage,
-			                    [tr = &tr](lng id) { return tr->get(id); });
+		void parser_common(lng inname_usage,
+		                   lng outname_usage,
+		                   bool outname_required = true) {
+			common.setup_parser(
+			    parser, inname_usage, outname_usage,
+			    [tr = &tr](lng id) { return tr->get(id); }, outname_required);
 		}
 
-		int read_strings() {
+		void options_common() {
+			common.setup_options(parser,
+			                     [tr = &tr](lng id) { return tr->get(id); });
+		}
+
+		void set_printer() {
 			using printer = diags::printer;
 			diag.set_printer<printer>(&diags::get_stdout(), tr.make(),
 			                          common.color_type);
+		}
+
+		int read_strings() {
+			set_printer();
 
 			return app::read_strings(parser.program(), common.inname, strings,
 			                         common.verbose, diag)
@@ -127,7 +154,12 @@ namespace lngs::app {
 
 		template <typename Writer>
 		int write(Writer writer) {
-			return app::write(parser.program(), diag, common.outname,
+			return write(common.outname, std::move(writer));
+		}
+
+		template <typename Writer>
+		int write(std::filesystem::path const& outname, Writer writer) {
+			return app::write(parser.program(), diag, outname,
 			                  std::move(writer), print_if(common.verbose));
 		}
 
@@ -337,39 +369,151 @@ namespace lngs::app {
 }  // namespace lngs::app
 
 namespace lngs::app::make {
-	int call(application_setup& setup) {
-		std::string moname, llname;
+	struct options {
+		std::string llname;
 		bool warp_missing = false;
+		bool with_formats = false;
+		bool dense = false;
+	};
+
+	int build(application_setup& setup,
+	          options const& opts,
+	          std::string const& moname,
+	          std::filesystem::path const& outname,
+	          diags::sources& diag) {
+		auto file = load_msgs(setup.strings, opts.warp_missing,
+		                      setup.common.verbose, diag.open(moname, "rb"),
+		                      diag);
+		if (diag.has_errors()) return 1;
+
+		if (!opts.llname.empty()) diag.open(opts.llname);
+
+		if (auto mo = diag.source(moname);
+		    !fix_attributes(file, mo, opts.llname, diag))
+			return 1;
+
+		if (opts.dense) make_dense(file, setup.strings);
+		if (opts.with_formats) file.formats = format_templates(file.strings);
+
+		return app::write(
+		    setup.parser.program(), diag, outname,
+		    [&](diags::outstream& out) { return file.write(out); },
+		    print_if(setup.common.verbose));
+	}
+
+	int build_all(application_setup& setup,
+	              options const& opts,
+	              std::filesystem::path const& msgs_dir,
+	              std::filesystem::path const& out_dir,
+	              unsigned jobs) {
+		auto src = setup.diag.source(setup.parser.program());
+
+		std::error_code ec;
+		auto const items = batch_items(msgs_dir, out_dir, ec);
+		if (ec) {
+			setup.diag.push_back(
+			    src.position()[diags::severity::error]
+			    << format(lng::ERR_FILE_MISSING, msgs_dir.string()));
+			return 1;
+		}
+		if (items.empty()) {
+			setup.diag.push_back(
+			    src.position()[diags::severity::error]
+			    << format(lng::ERR_NO_MSGS_FILES, msgs_dir.string()));
+			return 1;
+		}
+		std::filesystem::create_directories(out_dir, ec);
+
+		// Every file gets its own set of diagnostics, printed in the order
+		// of the files, when all of them are done.
+		std::vector<diags::sources> job_diags(items.size());
+		std::vector<int> results(items.size());
+		for (auto& diag : job_diags) {
+			diag.set_printer<diags::printer>(&diags::get_stdout(),
+			                                 setup.tr.make(),
+			                                 setup.common.color_type);
+		}
+
+		parallel_for(items.size(), jobs, [&](std::size_t index) {
+			auto const& item = items[index];
+			results[index] = build(setup, opts, item.msgs.string(), item.lng,
+			                       job_diags[index]);
+		});
+
+		int result = 0;
+		for (std::size_t index = 0; index < items.size(); ++index) {
+			job_diags[index].print_diagnostics();
+			if (results[index]) result = results[index];
+		}
+		return result;
+	}
+
+	int call(application_setup& setup) {
+		std::string moname;
+		std::filesystem::path msgs_dir, out_dir;
+		unsigned jobs = 0;
+		options opts{};
 
 		auto _ = [&setup](auto id) { return setup.tr.get(id); };
 
-		setup.parser_common(lng::ARGS_APP_IN_IDL, lng::ARGS_APP_OUT_LNG);
-		setup.parser.set<std::true_type>(warp_missing, "w", "warp")
+		setup.parser_common(lng::ARGS_APP_IN_IDL, lng::ARGS_APP_OUT_LNG,
+		                    false);
+		setup.parser.set<std::true_type>(opts.warp_missing, "w", "warp")
 		    .help(_(lng::ARGS_APP_WARP_MISSING_SINGULAR))
 		    .opt();
 		setup.parser.arg(moname, "m", "msgs")
 		    .meta(_(lng::ARGS_APP_META_PO_MO_FILE))
-		    .help(_(lng::ARGS_APP_IN_PO_MO));
-		setup.parser.arg(llname, "l", "lang")
+		    .help(_(lng::ARGS_APP_IN_PO_MO))
+		    .opt();
+		setup.parser.arg(msgs_dir, "msgs-dir")
+		    .meta(_(lng::ARGS_APP_META_DIR))
+		    .help(_(lng::ARGS_APP_IN_MSGS_DIR))
+		    .opt();
+		setup.parser.arg(out_dir, "out-dir")
+		    .meta(_(lng::ARGS_APP_META_DIR))
+		    .help(_(lng::ARGS_APP_OUT_LNG_DIR))
+		    .opt();
+		setup.parser.arg(jobs, "j", "jobs")
+		    .meta(_(lng::ARGS_APP_META_NUMBER))
+		    .help(_(lng::ARGS_APP_JOBS))
+		    .opt();
+		setup.parser.arg(opts.llname, "l", "lang")
 		    .meta(_(lng::ARGS_APP_META_FILE))
 		    .help(_(lng::ARGS_APP_IN_LLCC))
 		    .opt();
+		setup.parser.set<std::true_type>(opts.with_formats, "f", "fmt")
+		    .help(_(lng::ARGS_APP_WITH_FORMATS))
+		    .opt();
+		setup.parser.set<std::true_type>(opts.dense, "d", "dense")
+		    .help(_(lng::ARGS_APP_DENSE_FILE))
+		    .opt();
 		setup.parser.parse();
 
-		if (int res = setup.read_strings()) return res;
-
-		auto file = load_msgs(setup.strings, warp_missing, setup.common.verbose,
-		                      setup.diag.open(moname, "rb"), setup.diag);
-		if (setup.diag.has_errors()) return 1;
-
-		if (!llname.empty()) setup.diag.open(llname);
+		auto const required = [&](bool missing, char const* name) {
+			if (missing)
+				setup.parser.error(fmt::format(_(lng::ARGS_REQUIRED), name));
+		};
+		auto const exclusive = [&](bool both, char const* lhs,
+		                           char const* rhs) {
+			if (both)
+				setup.parser.error(
+				    fmt::format(_(lng::ARGS_APP_EXCLUSIVE), lhs, rhs));
+		};
+
+		auto const batch = !msgs_dir.empty();
+		if (batch) {
+			exclusive(!moname.empty(), "-m", "--msgs-dir");
+			exclusive(!setup.common.outname.empty(), "-o", "--msgs-dir");
+			required(out_dir.empty(), "--out-dir");
+		} else {
+			required(moname.empty(), "-m");
+			required(setup.common.outname.empty(), "-o");
+		}
 
-		if (auto mo = setup.diag.source(moname);
-		    !fix_attributes(file, mo, llname, setup.diag))
-			return 1;
+		if (int res = setup.read_strings()) return res;
 
-		return setup.write(
-		    [&](diags::outstream& out) { return file.write(out); });
+		if (batch) return build_all(setup, opts, msgs_dir, out_dir, jobs);
+		return build(setup, opts, moname, setup.common.outname, setup.diag);
 	}
 }  // namespace lngs::app::make
 
@@ -406,6 +550,9 @@ namespace lngs::app::pot {
 namespace lngs::app::enums {
 	int call(application_setup& setup) {
 		bool with_resource = false;
+		bool static_resource = false;
+		bool dense = false;
+		bool with_keys = false;
 
 		auto _ = [&setup](auto id) { return setup.tr.get(id); };
 
@@ -413,12 +560,22 @@ namespace lngs::app::enums {
 		setup.parser.set<std::true_type>(with_resource, "r", "resource")
 		    .help(_(lng::ARGS_APP_RESOURCE))
 		    .opt();
+		setup.parser.set<std::true_type>(static_resource, "s", "static")
+		    .help(_(lng::ARGS_APP_STATIC_RESOURCE))
+		    .opt();
+		setup.parser.set<std::true_type>(dense, "d", "dense")
+		    .help(_(lng::ARGS_APP_DENSE_SLOTS))
+		    .opt();
+		setup.parser.set<std::true_type>(with_keys, "k", "keys")
+		    .help(_(lng::ARGS_APP_KEY_MAP))
+		    .opt();
 		setup.parser.parse();
 
 		if (int res = setup.read_strings()) return res;
 
 		return setup.write([&](diags::outstream& out) {
-			return write(setup.env(out), with_resource);
+			return write(setup.env(out), with_resource, static_resource,
+			             dense, with_keys);
 		});
 	}
 }  // namespace lngs::app::enums
@@ -436,10 +593,29 @@ namespace lngs::app::py {
 }  // namespace lngs::app::py
 
 namespace lngs::app::res {
+	int read_plurals(application_setup& setup,
+	                 std::vector<std::string> const& msgs,
+	                 std::vector<plural_rule>& plurals) {
+		for (auto const& name : msgs) {
+			auto rule = native_plurals(setup.diag.open(name, "rb"), setup.diag);
+			if (setup.diag.has_errors()) return 1;
+			if (!rule) continue;
+			auto const known = std::any_of(
+			    plurals.begin(), plurals.end(), [&](auto const& item) {
+				    return item.culture == rule->culture &&
+				           item.forms == rule->forms;
+			    });
+			if (!known) plurals.push_back(std::move(*rule));
+		}
+		return 0;
+	}
+
 	int call(application_setup& setup) {
 		bool warp_strings = false;
 		bool with_keys = false;
+		bool static_table = false;
 		std::string include;
+		std::vector<std::string> msgs;
 
 		auto _ = [&setup](auto id) { return setup.tr.get(id); };
 
@@ -450,20 +626,32 @@ namespace lngs::app::res {
 		setup.parser.set<std::true_type>(with_keys, "k", "keys")
 		    .help(_(lng::ARGS_APP_WITH_KEY_BLOCK))
 		    .opt();
+		setup.parser.set<std::true_type>(static_table, "s", "static")
+		    .help(_(lng::ARGS_APP_STATIC_TABLE))
+		    .opt();
 		setup.parser.arg(include, "include")
 		    .meta(_(lng::ARGS_APP_META_FILE))
 		    .help(_(lng::ARGS_APP_ALT_INCLUDE))
 		    .opt();
+		setup.parser.arg(msgs, "plurals")
+		    .meta(_(lng::ARGS_APP_META_PO_MO_FILE))
+		    .help(_(lng::ARGS_APP_NATIVE_PLURALS))
+		    .opt();
 		setup.parser.parse();
 
 		if (int res = setup.read_strings()) return res;
 
-		if (include.empty()) include = setup.strings.project + ".hpp";
+		if (include.empty())
+			include = std::string{setup.strings.project} + ".hpp";
+
+		std::vector<plural_rule> plurals;
+		if (int res = read_plurals(setup, msgs, plurals)) return res;
 
 		auto file = make_resource(setup.strings, warp_strings, with_keys);
 
 		return setup.write([&](diags::outstream& out) {
-			return update_and_write(setup.env(out), file, include);
+			return update_and_write(setup.env(out), file, include,
+			                        static_table, plurals);
 		});
 	}
 }  // namespace lngs::app::res
@@ -530,6 +718,237 @@ namespace lngs::app::mustache {
 		});
 	}
 }  // namespace lngs::app::mustache
+
+namespace lngs::app::gen {
+	struct string_outstream : diags::outstream {
+		std::string contents;
+
+		using outstream::write;
+		std::size_t write(const void* data,
+		                  std::size_t length) noexcept final {
+			contents.append(static_cast<char const*>(data), length);
+			return length;
+		}
+	};
+
+	struct output {
+		std::filesystem::path name;
+		std::function<int(diags::outstream&)> render;
+		std::string contents{};
+		int result{};
+	};
+
+	int call(application_setup& setup) {
+		std::filesystem::path enums_name, res_name, pot_name, py_name;
+		bool with_resource = false;
+		bool static_table = false;
+		bool dense = false;
+		bool key_map = false;
+		bool warp_strings = false;
+		bool key_block = false;
+		std::string include;
+		std::vector<std::string> msgs;
+		std::string author;
+		pot::info nfo;
+
+		auto _ = [&setup](auto id) { return setup.tr.get(id); };
+
+		setup.parser.arg(setup.common.inname)
+		    .meta(_(lng::ARGS_APP_META_INPUT))
+		    .help(_(lng::ARGS_APP_IN_IDL));
+		setup.parser.arg(enums_name, "enums")
+		    .meta(_(lng::ARGS_APP_META_FILE))
+		    .help(_(lng::ARGS_APP_OUT_CPP))
+		    .opt();
+		setup.parser.arg(res_name, "res")
+		    .meta(_(lng::ARGS_APP_META_FILE))
+		    .help(_(lng::ARGS_APP_OUT_RES))
+		    .opt();
+		setup.parser.arg(pot_name, "pot")
+		    .meta(_(lng::ARGS_APP_META_FILE))
+		    .help(_(lng::ARGS_APP_OUT_POT))
+		    .opt();
+		setup.parser.arg(py_name, "py")
+		    .meta(_(lng::ARGS_APP_META_FILE))
+		    .help(_(lng::ARGS_APP_OUT_PY))
+		    .opt();
+		setup.parser.set<std::true_type>(with_resource, "r", "resource")
+		    .help(_(lng::ARGS_APP_RESOURCE))
+		    .opt();
+		setup.parser.set<std::true_type>(static_table, "s", "static")
+		    .help(_(lng::ARGS_APP_GEN_STATIC))
+		    .opt();
+		setup.parser.set<std::true_type>(dense, "d", "dense")
+		    .help(_(lng::ARGS_APP_DENSE_SLOTS))
+		    .opt();
+		setup.parser.set<std::true_type>(key_map, "k", "keys")
+		    .help(_(lng::ARGS_APP_KEY_MAP))
+		    .opt();
+		setup.parser.set<std::true_type>(warp_strings, "w", "warp")
+		    .help(_(lng::ARGS_APP_WARP_ALL_PLURAL))
+		    .opt();
+		setup.parser.set<std::true_type>(key_block, "res-keys")
+		    .help(_(lng::ARGS_APP_WITH_KEY_BLOCK))
+		    .opt();
+		setup.parser.arg(include, "include")
+		    .meta(_(lng::ARGS_APP_META_FILE))
+		    .help(_(lng::ARGS_APP_ALT_INCLUDE))
+		    .opt();
+		setup.parser.arg(msgs, "plurals")
+		    .meta(_(lng::ARGS_APP_META_PO_MO_FILE))
+		    .help(_(lng::ARGS_APP_NATIVE_PLURALS))
+		    .opt();
+		setup.parser.arg(nfo.copy, "c", "copy")
+		    .meta(_(lng::ARGS_APP_META_HOLDER))
+		    .help(_(lng::ARGS_APP_COPYRIGHT))
+		    .opt();
+		setup.parser.arg(author, "a", "author")
+		    .meta(_(lng::ARGS_APP_META_EMAIL))
+		    .help(_(lng::ARGS_APP_AUTHOR))
+		    .opt();
+		setup.parser.arg(nfo.title, "t", "title")
+		    .meta(_(lng::ARGS_APP_META_TITLE))
+		    .help(_(lng::ARGS_APP_TITLE))
+		    .opt();
+		setup.options_common();
+		setup.parser.parse();
+
+		if (enums_name.empty() && res_name.empty() && pot_name.empty() &&
+		    py_name.empty())
+			setup.parser.error(std::string{_(lng::ARGS_APP_NO_OUTPUTS)});
+		if (!pot_name.empty() && author.empty())
+			setup.parser.error(fmt::format(_(lng::ARGS_REQUIRED), "-a"));
+		if (!author.empty()) nfo.first_author = author;
+
+		if (int res = setup.read_strings()) return res;
+
+		// Everything reading other files, or reporting problems, runs here,
+		// so the rendering below only reads the definitions.
+		std::vector<output> outputs;
+		if (!enums_name.empty()) {
+			outputs.push_back({enums_name, [&](diags::outstream& out) {
+				                   return enums::write(
+				                       setup.env(out), with_resource,
+				                       static_table, dense, key_map);
+			                   }});
+		}
+
+		std::vector<res::plural_rule> plurals;
+		file resource;
+		if (!res_name.empty()) {
+			if (int res = res::read_plurals(setup, msgs, plurals)) return res;
+
+			if (include.empty())
+				include = std::string{setup.strings.project} + ".hpp";
+			resource =
+			    res::make_resource(setup.strings, warp_strings, key_block);
+
+			outputs.push_back({res_name, [&](diags::outstream& out) {
+				                   return res::update_and_write(
+				                       setup.env(out), resource, include,
+				                       static_table, plurals);
+			                   }});
+		}
+
+		if (!pot_name.empty()) {
+			nfo.year = pot::year_from_template(setup.diag.open(pot_name));
+			outputs.push_back({pot_name, [&](diags::outstream& out) {
+				                   return pot::write(setup.env(out), nfo);
+			                   }});
+		}
+
+		if (!py_name.empty()) {
+			outputs.push_back({py_name, [&](diags::outstream& out) {
+				                   return py::write(setup.env(out));
+			                   }});
+		}
+
+		parallel_for(outputs.size(), 0, [&](std::size_t index) {
+			auto& item = outputs[index];
+			string_outstream out;
+			item.result = item.render(out);
+			item.contents = std::move(out.contents);
+		});
+
+		// The files are written one after another, enums, res, pot and py,
+		// so two outputs on "-" do not mix.
+		for (auto& item : outputs) {
+			if (item.result) return item.result;
+			if (int res = setup.write(item.name, [&](diags::outstream& out) {
+				    out.write(item.contents.data(), item.contents.size());
+				    return 0;
+			    }))
+				return res;
+		}
+
+		return 0;
+	}
+}  // namespace lngs::app::gen
+
+namespace lngs::app::synth {
+	int call(application_setup& setup) {
+		options opts{};
+		std::vector<std::string> langs;
+		std::filesystem::path outdir;
+
+		auto _ = [&setup](auto id) { return setup.tr.get(id); };
+
+		setup.parser.arg(outdir, "o")
+		    .meta(_(lng::ARGS_APP_META_DIR))
+		    .help(_(lng::ARGS_APP_OUT_DIR));
+		setup.parser.arg(opts.strings, "n", "count")
+		    .meta(_(lng::ARGS_APP_META_NUMBER))
+		    .help(_(lng::ARGS_APP_SYNTH_COUNT))
+		    .opt();
+		setup.parser.arg(opts.seed, "seed")
+		    .meta(_(lng::ARGS_APP_META_NUMBER))
+		    .help(_(lng::ARGS_APP_SYNTH_SEED))
+		    .opt();
+		setup.parser.arg(opts.plurals, "plurals")
+		    .meta(_(lng::ARGS_APP_META_NUMBER))
+		    .help(_(lng::ARGS_APP_SYNTH_PLURALS))
+		    .opt();
+		setup.parser.arg(opts.helps, "helps")
+		    .meta(_(lng::ARGS_APP_META_NUMBER))
+		    .help(_(lng::ARGS_APP_SYNTH_HELPS))
+		    .opt();
+		setup.parser.arg(opts.key_length, "key-length")
+		    .meta(_(lng::ARGS_APP_META_NUMBER))
+		    .help(_(lng::ARGS_APP_SYNTH_KEY_LENGTH))
+		    .opt();
+		setup.parser.arg(langs, "l", "lang")
+		    .meta(_(lng::ARGS_APP_META_LANG))
+		    .help(_(lng::ARGS_APP_SYNTH_LANG))
+		    .opt();
+		setup.options_common();
+		setup.parser.parse();
+		setup.set_printer();
+
+		std::error_code ec;
+		std::filesystem::create_directories(outdir, ec);
+
+		auto const defs = make_strings(opts);
+		auto const save = [&](std::filesystem::path const& filename,
+		                      std::string const& contents) {
+			return setup.write(outdir / filename, [&](diags::outstream& out) {
+				out.write(contents.data(), contents.size());
+				return 0;
+			});
+		};
+
+		if (int res = save(std::string{defs.project} + ".idl", make_idl(defs)))
+			return res;
+		for (auto const& code : langs) {
+			auto const lang = find_language(code);
+			if (int res = save(code + ".po", make_po(defs, lang, opts.seed)))
+				return res;
+			if (int res = save(code + ".mo", make_mo(defs, lang, opts.seed)))
+				return res;
+		}
+
+		return 0;
+	}
+}  // namespace lngs::app::synth
 #endif  // !LNGS_ZERO
 
 struct command {
@@ -547,6 +966,8 @@ command commands[] = {
     {"res", lng::ARGS_APP_DESCR_CMD_RES, lngs::app::res::call},
     {"freeze", lng::ARGS_APP_DESCR_CMD_FREEZE, lngs::app::freeze::call},
     {"mustache", lng::ARGS_APP_DESCR_CMD_MUSTACHE, lngs::app::mustache::call},
+    {"gen", lng::ARGS_APP_DESCR_CMD_GEN, lngs::app::gen::call},
+    {"synth", lng::ARGS_APP_DESCR_CMD_SYNTH, lngs::app::synth::call},
 #endif
 };
 
@@ -6,8 +6,8 @@ namespace lngs::app {
     namespace {
         const char __resource[] = {
             "\x4c\x41\x4e\x47\x20\x68\x64\x72\x02\x00\x00\x00\x00\x01\x00\x00"
-            "\x08\x00\x00\x00\x73\x74\x72\x73\x81\x04\x00\x00\x65\x00\x00\x00"
-            "\x33\x01\x00\x00\xe9\x03\x00\x00\x00\x00\x00\x00\x07\x00\x00\x00"
+            "\x08\x00\x00\x00\x73\x74\x72\x73\xa0\x06\x00\x00\x7f\x00\x00\x00"
+            "\x81\x01\x00\x00\xe9\x03\x00\x00\x00\x00\x00\x00\x07\x00\x00\x00"
             "\xea\x03\x00\x00\x08\x00\x00\x00\x05\x00\x00\x00\xeb\x03\x00\x00"
             "\x0e\x00\x00\x00\x14\x00\x00\x00\xec\x03\x00\x00\x23\x00\x00\x00"
             "\x12\x00\x00\x00\xed\x03\x00\x00\x36\x00\x00\x00\x21\x00\x00\x00"
@@ -56,246 +56,382 @@ namespace lngs::app {
             "\x49\x04\x00\x00\x75\x09\x00\x00\x2d\x00\x00\x00\x4a\x04\x00\x00"
             "\xa3\x09\x00\x00\x46\x00\x00\x00\x4b\x04\x00\x00\xea\x09\x00\x00"
             "\x30\x00\x00\x00\x4c\x04\x00\x00\x1b\x0a\x00\x00\x1d\x00\x00\x00"
-            "\x4d\x04\x00\x00\x39\x0a\x00\x00\x0a\x00\x00\x00\x24\x04\x00\x00"
-            "\x44\x0a\x00\x00\x04\x00\x00\x00\x25\x04\x00\x00\x49\x0a\x00\x00"
-            "\x07\x00\x00\x00\x26\x04\x00\x00\x51\x0a\x00\x00\x05\x00\x00\x00"
-            "\x27\x04\x00\x00\x57\x0a\x00\x00\x05\x00\x00\x00\x28\x04\x00\x00"
-            "\x5d\x0a\x00\x00\x14\x00\x00\x00\x29\x04\x00\x00\x72\x0a\x00\x00"
-            "\x17\x00\x00\x00\x2a\x04\x00\x00\x8a\x0a\x00\x00\x19\x00\x00\x00"
-            "\x2b\x04\x00\x00\xa4\x0a\x00\x00\x0e\x00\x00\x00\x2c\x04\x00\x00"
-            "\xb3\x0a\x00\x00\x23\x00\x00\x00\x2d\x04\x00\x00\xd7\x0a\x00\x00"
-            "\x1a\x00\x00\x00\x2e\x04\x00\x00\xf2\x0a\x00\x00\x23\x00\x00\x00"
-            "\x2f\x04\x00\x00\x16\x0b\x00\x00\x27\x00\x00\x00\x30\x04\x00\x00"
-            "\x3e\x0b\x00\x00\x15\x00\x00\x00\x31\x04\x00\x00\x54\x0b\x00\x00"
-            "\x11\x00\x00\x00\x32\x04\x00\x00\x66\x0b\x00\x00\x0b\x00\x00\x00"
-            "\x33\x04\x00\x00\x72\x0b\x00\x00\x0b\x00\x00\x00\x34\x04\x00\x00"
-            "\x7e\x0b\x00\x00\x06\x00\x00\x00\x35\x04\x00\x00\x85\x0b\x00\x00"
-            "\x06\x00\x00\x00\x36\x04\x00\x00\x8c\x0b\x00\x00\x0a\x00\x00\x00"
-            "\x37\x04\x00\x00\x97\x0b\x00\x00\x0b\x00\x00\x00\x38\x04\x00\x00"
-            "\xa3\x0b\x00\x00\x0b\x00\x00\x00\x39\x04\x00\x00\xaf\x0b\x00\x00"
-            "\x06\x00\x00\x00\x3a\x04\x00\x00\xb6\x0b\x00\x00\x06\x00\x00\x00"
-            "\x3b\x04\x00\x00\xbd\x0b\x00\x00\x0a\x00\x00\x00\x3c\x04\x00\x00"
-            "\xc8\x0b\x00\x00\x33\x00\x00\x00\x3d\x04\x00\x00\xfc\x0b\x00\x00"
-            "\x30\x00\x00\x00\x3e\x04\x00\x00\x2d\x0c\x00\x00\x16\x00\x00\x00"
-            "\x3f\x04\x00\x00\x44\x0c\x00\x00\x19\x00\x00\x00\x40\x04\x00\x00"
-            "\x5e\x0c\x00\x00\x19\x00\x00\x00\x41\x04\x00\x00\x78\x0c\x00\x00"
-            "\x28\x00\x00\x00\x42\x04\x00\x00\xa1\x0c\x00\x00\x25\x00\x00\x00"
-            "\x43\x04\x00\x00\xc7\x0c\x00\x00\x1c\x00\x00\x00\x44\x04\x00\x00"
-            "\xe4\x0c\x00\x00\x1c\x00\x00\x00\x45\x04\x00\x00\x01\x0d\x00\x00"
-            "\x18\x00\x00\x00\x46\x04\x00\x00\x1a\x0d\x00\x00\x23\x00\x00\x00"
-            "\x75\x73\x61\x67\x65\x3a\x20\x00\x3c\x61\x72\x67\x3e\x00\x70\x6f"
-            "\x73\x69\x74\x69\x6f\x6e\x61\x6c\x20\x61\x72\x67\x75\x6d\x65\x6e"
-            "\x74\x73\x00\x6f\x70\x74\x69\x6f\x6e\x61\x6c\x20\x61\x72\x67\x75"
-            "\x6d\x65\x6e\x74\x73\x00\x73\x68\x6f\x77\x73\x20\x74\x68\x69\x73"
-            "\x20\x68\x65\x6c\x70\x20\x6d\x65\x73\x73\x61\x67\x65\x20\x61\x6e"
-            "\x64\x20\x65\x78\x69\x74\x73\x00\x75\x6e\x72\x65\x63\x6f\x67\x6e"
-            "\x69\x7a\x65\x64\x20\x61\x72\x67\x75\x6d\x65\x6e\x74\x3a\x20\x7b"
-            "\x30\x7d\x00\x61\x72\x67\x75\x6d\x65\x6e\x74\x20\x7b\x30\x7d\x3a"
-            "\x20\x65\x78\x70\x65\x63\x74\x65\x64\x20\x6f\x6e\x65\x20\x61\x72"
-            "\x67\x75\x6d\x65\x6e\x74\x00\x61\x72\x67\x75\x6d\x65\x6e\x74\x20"
-            "\x7b\x30\x7d\x3a\x20\x76\x61\x6c\x75\x65\x20\x77\x61\x73\x20\x6e"
-            "\x6f\x74\x20\x65\x78\x70\x65\x63\x74\x65\x64\x00\x61\x72\x67\x75"
-            "\x6d\x65\x6e\x74\x20\x7b\x30\x7d\x3a\x20\x65\x78\x70\x65\x63\x74"
-            "\x65\x64\x20\x61\x20\x6e\x75\x6d\x62\x65\x72\x00\x61\x72\x67\x75"
-            "\x6d\x65\x6e\x74\x20\x7b\x30\x7d\x3a\x20\x6e\x75\x6d\x62\x65\x72"
-            "\x20\x6f\x75\x74\x73\x69\x64\x65\x20\x6f\x66\x20\x65\x78\x70\x65"
-            "\x63\x74\x65\x64\x20\x62\x6f\x75\x6e\x64\x73\x00\x61\x72\x67\x75"
-            "\x6d\x65\x6e\x74\x20\x7b\x30\x7d\x3a\x20\x76\x61\x6c\x75\x65\x20"
-            "\x7b\x31\x7d\x20\x69\x73\x20\x6e\x6f\x74\x20\x72\x65\x63\x6f\x67"
-            "\x6e\x69\x7a\x65\x64\x00\x6b\x6e\x6f\x77\x6e\x20\x76\x61\x6c\x75"
-            "\x65\x73\x20\x66\x6f\x72\x20\x7b\x30\x7d\x3a\x20\x7b\x31\x7d\x00"
-            "\x61\x72\x67\x75\x6d\x65\x6e\x74\x20\x7b\x30\x7d\x20\x69\x73\x20"
-            "\x72\x65\x71\x75\x69\x72\x65\x64\x00\x7b\x30\x7d\x3a\x20\x65\x72"
-            "\x72\x6f\x72\x3a\x20\x7b\x31\x7d\x00\x54\x72\x61\x6e\x73\x6c\x61"
-            "\x74\x65\x73\x20\x50\x4f\x2f\x4d\x4f\x20\x66\x69\x6c\x65\x20\x74"
-            "\x6f\x20\x4c\x4e\x47\x20\x66\x69\x6c\x65\x2e\x00\x43\x72\x65\x61"
-            "\x74\x65\x73\x20\x50\x4f\x54\x20\x66\x69\x6c\x65\x20\x66\x72\x6f"
-            "\x6d\x20\x6d\x65\x73\x73\x61\x67\x65\x20\x66\x69\x6c\x65\x2e\x00"
-            "\x43\x72\x65\x61\x74\x65\x73\x20\x68\x65\x61\x64\x65\x72\x20\x66"
-            "\x69\x6c\x65\x20\x66\x72\x6f\x6d\x20\x6d\x65\x73\x73\x61\x67\x65"
-            "\x20\x66\x69\x6c\x65\x2e\x00\x43\x72\x65\x61\x74\x65\x73\x20\x50"
-            "\x79\x74\x68\x6f\x6e\x20\x6d\x6f\x64\x75\x6c\x65\x20\x77\x69\x74"
-            "\x68\x20\x73\x74\x72\x69\x6e\x67\x20\x6b\x65\x79\x73\x2e\x00\x43"
-            "\x72\x65\x61\x74\x65\x73\x20\x43\x2b\x2b\x20\x66\x69\x6c\x65\x20"
-            "\x77\x69\x74\x68\x20\x66\x61\x6c\x6c\x62\x61\x63\x6b\x20\x72\x65"
-            "\x73\x6f\x75\x72\x63\x65\x20\x66\x6f\x72\x20\x74\x68\x65\x20\x6d"
-            "\x65\x73\x73\x61\x67\x65\x20\x66\x69\x6c\x65\x2e\x00\x52\x65\x61"
-            "\x64\x73\x20\x74\x68\x65\x20\x6c\x61\x6e\x67\x75\x61\x67\x65\x20"
-            "\x64\x65\x73\x63\x72\x69\x70\x74\x69\x6f\x6e\x20\x66\x69\x6c\x65"
-            "\x20\x61\x6e\x64\x20\x61\x73\x73\x69\x67\x6e\x73\x20\x76\x61\x6c"
-            "\x75\x65\x73\x20\x74\x6f\x20\x6e\x65\x77\x20\x73\x74\x72\x69\x6e"
-            "\x67\x73\x2e\x00\x55\x73\x65\x73\x20\x61\x20\x63\x75\x73\x74\x6f"
-            "\x6d\x20\x7b\x7b\x6d\x75\x73\x74\x61\x63\x68\x65\x7d\x7d\x20\x74"
-            "\x65\x6d\x70\x6c\x61\x74\x65\x2e\x00\x5b\x2d\x68\x5d\x20\x5b\x2d"
-            "\x2d\x76\x65\x72\x73\x69\x6f\x6e\x5d\x20\x5b\x2d\x2d\x73\x68\x61"
-            "\x72\x65\x20\x3c\x64\x69\x72\x3e\x5d\x20\x3c\x63\x6f\x6d\x6d\x61"
-            "\x6e\x64\x3e\x20\x3c\x73\x6f\x75\x72\x63\x65\x3e\x20\x2d\x6f\x20"
-            "\x3c\x66\x69\x6c\x65\x3e\x20\x5b\x3c\x61\x72\x67\x75\x6d\x65\x6e"
-            "\x74\x73\x3e\x5d\x00\x54\x68\x65\x20\x66\x6c\x6f\x77\x20\x66\x6f"
-            "\x72\x20\x73\x74\x72\x69\x6e\x67\x20\x6d\x61\x6e\x61\x67\x65\x6d"
-            "\x65\x6e\x74\x20\x61\x6e\x64\x20\x63\x72\x65\x61\x74\x69\x6f\x6e"
-            "\x00\x54\x72\x61\x6e\x73\x6c\x61\x74\x69\x6f\x6e\x20\x4d\x61\x6e"
-            "\x61\x67\x65\x72\x00\x54\x72\x61\x6e\x73\x6c\x61\x74\x6f\x72\x00"
-            "\x44\x65\x76\x65\x6c\x6f\x70\x65\x72\x20\x28\x63\x6f\x6d\x70\x69"
-            "\x6c\x69\x6e\x67\x20\x65\x78\x69\x73\x74\x69\x6e\x67\x20\x6c\x69"
-            "\x73\x74\x29\x00\x44\x65\x76\x65\x6c\x6f\x70\x65\x72\x20\x28\x61"
-            "\x64\x64\x69\x6e\x67\x20\x6e\x65\x77\x20\x73\x74\x72\x69\x6e\x67"
-            "\x29\x00\x44\x65\x76\x65\x6c\x6f\x70\x65\x72\x20\x28\x72\x65\x6c"
-            "\x65\x61\x73\x69\x6e\x67\x20\x61\x20\x62\x75\x69\x6c\x64\x29\x00"
-            "\x6b\x6e\x6f\x77\x6e\x20\x63\x6f\x6d\x6d\x61\x6e\x64\x73\x00\x63"
-            "\x6f\x6d\x6d\x61\x6e\x64\x20\x6d\x69\x73\x73\x69\x6e\x67\x00\x75"
-            "\x6e\x6b\x6e\x6f\x77\x6e\x20\x63\x6f\x6d\x6d\x61\x6e\x64\x3a\x20"
-            "\x7b\x30\x7d\x00\x3c\x77\x68\x65\x6e\x3e\x00\x3c\x73\x6f\x75\x72"
-            "\x63\x65\x3e\x00\x3c\x66\x69\x6c\x65\x3e\x00\x3c\x68\x6f\x6c\x64"
-            "\x65\x72\x3e\x00\x3c\x65\x6d\x61\x69\x6c\x3e\x00\x3c\x74\x69\x74"
-            "\x6c\x65\x3e\x00\x3c\x67\x65\x74\x74\x65\x78\x74\x20\x66\x69\x6c"
-            "\x65\x3e\x00\x3c\x64\x69\x72\x3e\x00\x73\x68\x6f\x77\x73\x20\x70"
-            "\x72\x6f\x67\x72\x61\x6d\x20\x76\x65\x72\x73\x69\x6f\x6e\x20\x61"
-            "\x6e\x64\x20\x65\x78\x69\x74\x73\x00\x75\x73\x65\x73\x20\x63\x6f"
-            "\x6c\x6f\x72\x20\x69\x6e\x20\x64\x69\x61\x67\x6e\x6f\x73\x74\x69"
-            "\x63\x73\x3b\x20\x3c\x77\x68\x65\x6e\x3e\x20\x69\x73\x20\x27\x6e"
-            "\x65\x76\x65\x72\x27\x2c\x20\x27\x61\x6c\x77\x61\x79\x73\x27\x2c"
-            "\x20\x6f\x72\x20\x27\x61\x75\x74\x6f\x27\x00\x72\x65\x70\x6c\x61"
-            "\x63\x65\x73\x20\x7b\x30\x7d\x20\x61\x73\x20\x6e\x65\x77\x20\x64"
-            "\x61\x74\x61\x20\x64\x69\x72\x65\x63\x74\x6f\x72\x79\x00\x73\x68"
-            "\x6f\x77\x73\x20\x6d\x6f\x72\x65\x20\x69\x6e\x66\x6f\x00\x73\x65"
-            "\x74\x73\x20\x74\x68\x65\x20\x6e\x61\x6d\x65\x20\x6f\x66\x20\x63"
-            "\x6f\x70\x79\x72\x69\x67\x68\x74\x20\x68\x6f\x6c\x64\x65\x72\x00"
-            "\x73\x65\x74\x73\x20\x74\x68\x65\x20\x6e\x61\x6d\x65\x20\x61\x6e"
-            "\x64\x20\x65\x6d\x61\x69\x6c\x20\x61\x64\x64\x72\x65\x73\x73\x20"
-            "\x6f\x66\x20\x66\x69\x72\x73\x74\x20\x61\x75\x74\x68\x6f\x72\x00"
-            "\x73\x65\x74\x73\x20\x61\x20\x64\x65\x73\x63\x72\x69\x70\x74\x69"
-            "\x76\x65\x20\x74\x69\x74\x6c\x65\x20\x66\x6f\x72\x20\x74\x68\x65"
-            "\x20\x50\x4f\x54\x20\x70\x72\x6f\x6a\x65\x63\x74\x00\x69\x6e\x73"
-            "\x74\x72\x75\x63\x74\x73\x20\x74\x68\x65\x20\x53\x74\x72\x69\x6e"
-            "\x67\x73\x20\x74\x79\x70\x65\x20\x74\x6f\x20\x75\x73\x65\x20\x64"
-            "\x61\x74\x61\x20\x67\x65\x6e\x65\x72\x61\x74\x65\x64\x20\x62\x79"
-            "\x20\x74\x68\x65\x20\x60\x6c\x6e\x67\x73\x20\x72\x65\x73\x27\x2e"
-            "\x00\x72\x65\x70\x6c\x61\x63\x65\x73\x20\x6d\x69\x73\x73\x69\x6e"
-            "\x67\x20\x73\x74\x72\x69\x6e\x67\x73\x20\x77\x69\x74\x68\x20\x77"
-            "\x61\x72\x70\x65\x64\x20\x6f\x6e\x65\x73\x3b\x20\x72\x65\x73\x75"
-            "\x6c\x74\x69\x6e\x67\x20\x73\x74\x72\x69\x6e\x67\x73\x20\x61\x72"
-            "\x65\x20\x61\x6c\x77\x61\x79\x73\x20\x73\x69\x6e\x67\x75\x6c\x61"
-            "\x72\x00\x72\x65\x70\x6c\x61\x63\x65\x73\x20\x61\x6c\x6c\x20\x73"
-            "\x74\x72\x69\x6e\x67\x73\x20\x77\x69\x74\x68\x20\x77\x61\x72\x70"
-            "\x65\x64\x20\x6f\x6e\x65\x73\x3b\x20\x70\x6c\x75\x72\x61\x6c\x20"
-            "\x73\x74\x72\x69\x6e\x67\x73\x20\x77\x69\x6c\x6c\x20\x73\x74\x69"
-            "\x6c\x6c\x20\x62\x65\x20\x70\x6c\x75\x72\x61\x6c\x20\x28\x61\x73"
-            "\x20\x69\x66\x20\x45\x6e\x67\x6c\x69\x73\x68\x29\x00\x61\x64\x64"
-            "\x73\x20\x62\x6c\x6f\x63\x6b\x20\x6f\x66\x20\x73\x74\x72\x69\x6e"
-            "\x67\x73\x20\x77\x69\x74\x68\x20\x6b\x65\x79\x20\x6e\x61\x6d\x65"
-            "\x73\x00\x73\x65\x74\x73\x20\x66\x69\x6c\x65\x20\x6e\x61\x6d\x65"
-            "\x20\x74\x6f\x20\x23\x69\x6e\x63\x6c\x75\x64\x65\x20\x69\x6e\x20"
-            "\x74\x68\x65\x20\x69\x6d\x70\x6c\x65\x6d\x65\x6e\x74\x61\x74\x69"
-            "\x6f\x6e\x20\x6f\x66\x20\x74\x68\x65\x20\x52\x65\x73\x6f\x75\x72"
-            "\x63\x65\x20\x63\x6c\x61\x73\x73\x3b\x20\x64\x65\x66\x61\x75\x6c"
-            "\x74\x73\x20\x74\x6f\x20\x22\x3c\x70\x72\x6f\x6a\x65\x63\x74\x3e"
-            "\x2e\x68\x70\x70\x22\x2e\x00\x73\x65\x74\x73\x20\x50\x4f\x54\x20"
-            "\x66\x69\x6c\x65\x20\x6e\x61\x6d\x65\x20\x74\x6f\x20\x77\x72\x69"
-            "\x74\x65\x20\x72\x65\x73\x75\x6c\x74\x73\x20\x74\x6f\x3b\x20\x75"
-            "\x73\x65\x20\x22\x2d\x22\x20\x66\x6f\x72\x20\x73\x74\x61\x6e\x64"
-            "\x61\x72\x64\x20\x6f\x75\x74\x70\x75\x74\x00\x73\x65\x74\x73\x20"
-            "\x43\x2b\x2b\x20\x68\x65\x61\x64\x65\x72\x20\x66\x69\x6c\x65\x20"
-            "\x6e\x61\x6d\x65\x20\x74\x6f\x20\x77\x72\x69\x74\x65\x20\x72\x65"
-            "\x73\x75\x6c\x74\x73\x20\x74\x6f\x3b\x20\x75\x73\x65\x20\x22\x2d"
-            "\x22\x20\x66\x6f\x72\x20\x73\x74\x61\x6e\x64\x61\x72\x64\x20\x6f"
-            "\x75\x74\x70\x75\x74\x00\x73\x65\x74\x73\x20\x43\x2b\x2b\x20\x63"
-            "\x6f\x64\x65\x20\x66\x69\x6c\x65\x20\x6e\x61\x6d\x65\x20\x77\x69"
-            "\x74\x68\x20\x62\x75\x69\x6c\x74\x69\x6e\x20\x73\x74\x72\x69\x6e"
-            "\x67\x73\x20\x74\x6f\x20\x77\x72\x69\x74\x65\x20\x72\x65\x73\x75"
-            "\x6c\x74\x73\x20\x74\x6f\x3b\x20\x75\x73\x65\x20\x22\x2d\x22\x20"
-            "\x66\x6f\x72\x20\x73\x74\x61\x6e\x64\x61\x72\x64\x20\x6f\x75\x74"
-            "\x70\x75\x74\x00\x73\x65\x74\x73\x20\x50\x79\x74\x68\x6f\x6e\x20"
-            "\x66\x69\x6c\x65\x20\x6e\x61\x6d\x65\x20\x74\x6f\x20\x77\x72\x69"
-            "\x74\x65\x20\x72\x65\x73\x75\x6c\x74\x73\x20\x74\x6f\x3b\x20\x75"
-            "\x73\x65\x20\x22\x2d\x22\x20\x66\x6f\x72\x20\x73\x74\x61\x6e\x64"
-            "\x61\x72\x64\x20\x6f\x75\x74\x70\x75\x74\x00\x73\x65\x74\x73\x20"
-            "\x4c\x4e\x47\x20\x62\x69\x6e\x61\x72\x79\x20\x66\x69\x6c\x65\x20"
-            "\x6e\x61\x6d\x65\x20\x74\x6f\x20\x77\x72\x69\x74\x65\x20\x72\x65"
-            "\x73\x75\x6c\x74\x73\x20\x74\x6f\x3b\x20\x75\x73\x65\x20\x22\x2d"
-            "\x22\x20\x66\x6f\x72\x20\x73\x74\x61\x6e\x64\x61\x72\x64\x20\x6f"
-            "\x75\x74\x70\x75\x74\x00\x73\x65\x74\x73\x20\x49\x44\x4c\x20\x6d"
-            "\x65\x73\x73\x61\x67\x65\x20\x66\x69\x6c\x65\x20\x6e\x61\x6d\x65"
-            "\x20\x74\x6f\x20\x77\x72\x69\x74\x65\x20\x72\x65\x73\x75\x6c\x74"
-            "\x73\x20\x74\x6f\x3b\x20\x69\x74\x20\x6d\x61\x79\x20\x62\x65\x20"
-            "\x74\x68\x65\x20\x73\x61\x6d\x65\x20\x61\x73\x20\x69\x6e\x70\x75"
-            "\x74\x3b\x20\x75\x73\x65\x20\x22\x2d\x22\x20\x66\x6f\x72\x20\x73"
-            "\x74\x61\x6e\x64\x61\x72\x64\x20\x6f\x75\x74\x70\x75\x74\x00\x73"
-            "\x65\x74\x73\x20\x66\x69\x6c\x65\x20\x6e\x61\x6d\x65\x20\x74\x6f"
-            "\x20\x77\x72\x74\x69\x65\x20\x72\x65\x73\x75\x6c\x74\x73\x20\x74"
-            "\x6f\x3b\x20\x75\x73\x65\x20\x22\x2d\x22\x20\x66\x6f\x72\x20\x73"
-            "\x74\x61\x6e\x64\x61\x72\x64\x20\x6f\x75\x74\x70\x75\x74\x00\x73"
-            "\x65\x74\x73\x20\x6d\x65\x73\x73\x61\x67\x65\x20\x66\x69\x6c\x65"
-            "\x20\x6e\x61\x6d\x65\x20\x74\x6f\x20\x72\x65\x61\x64\x20\x66\x72"
-            "\x6f\x6d\x00\x73\x65\x74\x73\x20\x47\x65\x74\x54\x65\x78\x74\x20"
-            "\x6d\x65\x73\x73\x61\x67\x65\x20\x66\x69\x6c\x65\x20\x6e\x61\x6d"
-            "\x65\x20\x74\x6f\x20\x72\x65\x61\x64\x20\x66\x72\x6f\x6d\x00\x73"
-            "\x65\x74\x73\x20\x41\x54\x54\x52\x5f\x4c\x41\x4e\x47\x55\x41\x47"
-            "\x45\x20\x66\x69\x6c\x65\x20\x6e\x61\x6d\x65\x20\x77\x69\x74\x68"
-            "\x20\x6c\x6c\x5f\x43\x43\x20\x28\x6c\x61\x6e\x67\x75\x61\x67\x65"
-            "\x5f\x43\x4f\x55\x4e\x54\x52\x59\x29\x20\x6e\x61\x6d\x65\x73\x20"
-            "\x6c\x69\x73\x74\x00\x61\x64\x64\x73\x20\x61\x64\x64\x69\x74\x69"
-            "\x6f\x6e\x61\x6c\x20\x64\x69\x72\x65\x63\x74\x6f\x72\x79\x20\x66"
-            "\x6f\x72\x20\x74\x65\x6d\x70\x6c\x61\x74\x65\x20\x6c\x6f\x6f\x6b"
-            "\x75\x70\x00\x73\x65\x6c\x65\x63\x74\x73\x20\x61\x20\x74\x65\x6d"
-            "\x70\x6c\x61\x74\x65\x20\x6e\x61\x6d\x65\x20\x74\x6f\x20\x75\x73"
-            "\x65\x20\x66\x6f\x72\x20\x6f\x75\x74\x70\x75\x74\x20\x28\x66\x69"
-            "\x6c\x65\x6e\x61\x6d\x65\x20\x77\x69\x74\x68\x6f\x75\x74\x20\x65"
-            "\x78\x74\x65\x6e\x73\x69\x6f\x6e\x29\x00\x73\x65\x74\x73\x20\x61"
-            "\x64\x64\x69\x74\x69\x6f\x6e\x61\x6c\x20\x63\x6f\x6e\x74\x65\x78"
-            "\x74\x20\x66\x6f\x72\x20\x63\x75\x73\x74\x6f\x6d\x20\x6d\x75\x73"
-            "\x74\x61\x63\x68\x65\x20\x66\x69\x6c\x65\x00\x6f\x75\x74\x70\x75"
-            "\x74\x73\x20\x61\x64\x64\x69\x74\x69\x6f\x6e\x61\x6c\x20\x64\x65"
-            "\x62\x75\x67\x20\x64\x61\x74\x61\x00\x3c\x74\x65\x6d\x70\x6c\x61"
-            "\x74\x65\x3e\x00\x6e\x6f\x74\x65\x00\x77\x61\x72\x6e\x69\x6e\x67"
-            "\x00\x65\x72\x72\x6f\x72\x00\x66\x61\x74\x61\x6c\x00\x63\x6f\x75"
-            "\x6c\x64\x20\x6e\x6f\x74\x20\x6f\x70\x65\x6e\x20\x60\x7b\x30\x7d"
-            "\x27\x00\x63\x6f\x75\x6c\x64\x20\x6e\x6f\x74\x20\x6f\x70\x65\x6e"
-            "\x20\x74\x68\x65\x20\x66\x69\x6c\x65\x00\x60\x7b\x30\x7d\x27\x20"
-            "\x69\x73\x20\x6e\x6f\x74\x20\x73\x74\x72\x69\x6e\x67\x73\x20\x66"
-            "\x69\x6c\x65\x00\x6e\x6f\x20\x6e\x65\x77\x20\x73\x74\x72\x69\x6e"
-            "\x67\x73\x00\x61\x74\x74\x72\x69\x62\x75\x74\x65\x20\x60\x7b\x30"
-            "\x7d\x27\x20\x73\x68\x6f\x75\x6c\x64\x20\x6e\x6f\x74\x20\x62\x65"
-            "\x20\x65\x6d\x70\x74\x79\x00\x61\x74\x74\x72\x69\x62\x75\x74\x65"
-            "\x20\x60\x7b\x30\x7d\x27\x20\x69\x73\x20\x6d\x69\x73\x73\x69\x6e"
-            "\x67\x00\x72\x65\x71\x75\x69\x72\x65\x64\x20\x61\x74\x74\x72\x69"
-            "\x62\x75\x74\x65\x20\x60\x7b\x30\x7d\x27\x20\x69\x73\x20\x6d\x69"
-            "\x73\x73\x69\x6e\x67\x00\x62\x65\x66\x6f\x72\x65\x20\x66\x69\x6e"
-            "\x61\x6c\x69\x7a\x69\x6e\x67\x20\x61\x20\x76\x61\x6c\x75\x65\x2c"
-            "\x20\x75\x73\x65\x20\x60\x69\x64\x28\x2d\x31\x29\x27\x00\x65\x78"
-            "\x70\x65\x63\x74\x65\x64\x20\x7b\x30\x7d\x2c\x20\x67\x6f\x74\x20"
-            "\x7b\x31\x7d\x00\x75\x6e\x72\x65\x63\x6f\x67\x6e\x69\x7a\x65\x64"
-            "\x20\x74\x65\x78\x74\x00\x65\x6e\x64\x20\x6f\x66\x20\x66\x69\x6c"
-            "\x65\x00\x65\x6e\x64\x20\x6f\x66\x20\x6c\x69\x6e\x65\x00\x73\x74"
-            "\x72\x69\x6e\x67\x00\x6e\x75\x6d\x62\x65\x72\x00\x69\x64\x65\x6e"
-            "\x74\x69\x66\x69\x65\x72\x00\x65\x6e\x64\x20\x6f\x66\x20\x66\x69"
-            "\x6c\x65\x00\x65\x6e\x64\x20\x6f\x66\x20\x6c\x69\x6e\x65\x00\x73"
-            "\x74\x72\x69\x6e\x67\x00\x6e\x75\x6d\x62\x65\x72\x00\x69\x64\x65"
-            "\x6e\x74\x69\x66\x69\x65\x72\x00\x6d\x65\x73\x73\x61\x67\x65\x20"
-            "\x66\x69\x6c\x65\x20\x64\x6f\x65\x73\x20\x6e\x6f\x74\x20\x63\x6f"
-            "\x6e\x74\x61\x69\x6e\x20\x74\x72\x61\x6e\x73\x6c\x61\x74\x69\x6f"
-            "\x6e\x20\x66\x6f\x72\x20\x22\x7b\x30\x7d\x22\x00\x6d\x65\x73\x73"
-            "\x61\x67\x65\x20\x66\x69\x6c\x65\x20\x64\x6f\x65\x73\x20\x6e\x6f"
-            "\x74\x20\x63\x6f\x6e\x74\x61\x69\x6e\x20\x4c\x61\x6e\x67\x75\x61"
-            "\x67\x65\x20\x61\x74\x74\x72\x69\x62\x75\x74\x65\x00\x6c\x6f\x63"
-            "\x61\x6c\x65\x20\x7b\x30\x7d\x20\x68\x61\x73\x20\x6e\x6f\x20\x6e"
-            "\x61\x6d\x65\x00\x6e\x6f\x20\x7b\x30\x7d\x20\x6c\x6f\x63\x61\x6c"
-            "\x65\x20\x6f\x6e\x20\x74\x68\x65\x20\x6c\x69\x73\x74\x00\x67\x65"
-            "\x74\x74\x65\x78\x74\x20\x66\x69\x6c\x65\x20\x66\x6f\x72\x6d\x61"
-            "\x74\x20\x65\x72\x72\x6f\x72\x00\x74\x77\x6f\x20\x6f\x72\x20\x6d"
-            "\x6f\x72\x65\x20\x62\x6c\x6f\x63\x6b\x73\x20\x6f\x63\x63\x75\x70"
-            "\x79\x20\x74\x68\x65\x20\x73\x61\x6d\x65\x20\x73\x70\x61\x63\x65"
-            "\x00\x73\x74\x72\x69\x6e\x67\x20\x6e\x6f\x74\x20\x63\x6f\x6e\x74"
-            "\x61\x69\x6e\x65\x64\x20\x69\x6e\x73\x69\x64\x65\x20\x74\x68\x65"
-            "\x20\x62\x6c\x6f\x63\x6b\x00\x66\x69\x6c\x65\x20\x74\x72\x75\x6e"
-            "\x63\x61\x74\x65\x64\x3b\x20\x64\x61\x74\x61\x20\x6d\x69\x73\x73"
-            "\x69\x6e\x67\x00\x73\x74\x72\x69\x6e\x67\x73\x20\x6d\x75\x73\x74"
-            "\x20\x65\x6e\x64\x20\x77\x69\x74\x68\x20\x61\x20\x7a\x65\x72\x6f"
-            "\x00\x75\x6e\x72\x65\x63\x6f\x67\x6e\x69\x7a\x65\x64\x20\x66\x69"
-            "\x65\x6c\x64\x20\x60\x7b\x30\x7d\x27\x00\x75\x6e\x72\x65\x63\x6f"
-            "\x67\x6e\x69\x7a\x65\x64\x20\x65\x73\x63\x61\x70\x65\x20\x73\x65"
-            "\x71\x75\x65\x6e\x63\x65\x20\x60\x5c\x7b\x30\x7d\x27\x00\x00\x00"
-            "\x6c\x61\x73\x74\x00\x00\x00\x00"
+            "\x4d\x04\x00\x00\x39\x0a\x00\x00\x0a\x00\x00\x00\x4e\x04\x00\x00"
+            "\x44\x0a\x00\x00\x41\x00\x00\x00\x4f\x04\x00\x00\x86\x0a\x00\x00"
+            "\x3b\x00\x00\x00\x50\x04\x00\x00\xc2\x0a\x00\x00\x2e\x00\x00\x00"
+            "\x51\x04\x00\x00\xf1\x0a\x00\x00\x08\x00\x00\x00\x52\x04\x00\x00"
+            "\xfa\x0a\x00\x00\x06\x00\x00\x00\x53\x04\x00\x00\x01\x0b\x00\x00"
+            "\x38\x00\x00\x00\x54\x04\x00\x00\x3a\x0b\x00\x00\x49\x00\x00\x00"
+            "\x55\x04\x00\x00\x84\x0b\x00\x00\x40\x00\x00\x00\x56\x04\x00\x00"
+            "\xc5\x0b\x00\x00\x3d\x00\x00\x00\x57\x04\x00\x00\x03\x0c\x00\x00"
+            "\x39\x00\x00\x00\x58\x04\x00\x00\x3d\x0c\x00\x00\x40\x00\x00\x00"
+            "\x59\x04\x00\x00\x7e\x0c\x00\x00\x6b\x00\x00\x00\x5a\x04\x00\x00"
+            "\xea\x0c\x00\x00\x61\x00\x00\x00\x5b\x04\x00\x00\x4c\x0d\x00\x00"
+            "\x5f\x00\x00\x00\x5c\x04\x00\x00\xac\x0d\x00\x00\x66\x00\x00\x00"
+            "\x5d\x04\x00\x00\x13\x0e\x00\x00\x5b\x00\x00\x00\x5e\x04\x00\x00"
+            "\x6f\x0e\x00\x00\x7f\x00\x00\x00\x5f\x04\x00\x00\xef\x0e\x00\x00"
+            "\x6b\x00\x00\x00\x60\x04\x00\x00\x5b\x0f\x00\x00\x48\x00\x00\x00"
+            "\x61\x04\x00\x00\xa4\x0f\x00\x00\x5d\x00\x00\x00\x62\x04\x00\x00"
+            "\x02\x10\x00\x00\x2d\x00\x00\x00\x63\x04\x00\x00\x30\x10\x00\x00"
+            "\x54\x00\x00\x00\x64\x04\x00\x00\x85\x10\x00\x00\x51\x00\x00\x00"
+            "\x65\x04\x00\x00\xd7\x10\x00\x00\x39\x00\x00\x00\x24\x04\x00\x00"
+            "\x11\x11\x00\x00\x04\x00\x00\x00\x25\x04\x00\x00\x16\x11\x00\x00"
+            "\x07\x00\x00\x00\x26\x04\x00\x00\x1e\x11\x00\x00\x05\x00\x00\x00"
+            "\x27\x04\x00\x00\x24\x11\x00\x00\x05\x00\x00\x00\x28\x04\x00\x00"
+            "\x2a\x11\x00\x00\x14\x00\x00\x00\x29\x04\x00\x00\x3f\x11\x00\x00"
+            "\x17\x00\x00\x00\x2a\x04\x00\x00\x57\x11\x00\x00\x19\x00\x00\x00"
+            "\x2b\x04\x00\x00\x71\x11\x00\x00\x0e\x00\x00\x00\x2c\x04\x00\x00"
+            "\x80\x11\x00\x00\x23\x00\x00\x00\x2d\x04\x00\x00\xa4\x11\x00\x00"
+            "\x1a\x00\x00\x00\x2e\x04\x00\x00\xbf\x11\x00\x00\x23\x00\x00\x00"
+            "\x2f\x04\x00\x00\xe3\x11\x00\x00\x27\x00\x00\x00\x30\x04\x00\x00"
+            "\x0b\x12\x00\x00\x15\x00\x00\x00\x31\x04\x00\x00\x21\x12\x00\x00"
+            "\x11\x00\x00\x00\x32\x04\x00\x00\x33\x12\x00\x00\x0b\x00\x00\x00"
+            "\x33\x04\x00\x00\x3f\x12\x00\x00\x0b\x00\x00\x00\x34\x04\x00\x00"
+            "\x4b\x12\x00\x00\x06\x00\x00\x00\x35\x04\x00\x00\x52\x12\x00\x00"
+            "\x06\x00\x00\x00\x36\x04\x00\x00\x59\x12\x00\x00\x0a\x00\x00\x00"
+            "\x37\x04\x00\x00\x64\x12\x00\x00\x0b\x00\x00\x00\x38\x04\x00\x00"
+            "\x70\x12\x00\x00\x0b\x00\x00\x00\x39\x04\x00\x00\x7c\x12\x00\x00"
+            "\x06\x00\x00\x00\x3a\x04\x00\x00\x83\x12\x00\x00\x06\x00\x00\x00"
+            "\x3b\x04\x00\x00\x8a\x12\x00\x00\x0a\x00\x00\x00\x3c\x04\x00\x00"
+            "\x95\x12\x00\x00\x33\x00\x00\x00\x3d\x04\x00\x00\xc9\x12\x00\x00"
+            "\x30\x00\x00\x00\x3e\x04\x00\x00\xfa\x12\x00\x00\x16\x00\x00\x00"
+            "\x3f\x04\x00\x00\x11\x13\x00\x00\x19\x00\x00\x00\x40\x04\x00\x00"
+            "\x2b\x13\x00\x00\x19\x00\x00\x00\x41\x04\x00\x00\x45\x13\x00\x00"
+            "\x28\x00\x00\x00\x42\x04\x00\x00\x6e\x13\x00\x00\x25\x00\x00\x00"
+            "\x43\x04\x00\x00\x94\x13\x00\x00\x1c\x00\x00\x00\x44\x04\x00\x00"
+            "\xb1\x13\x00\x00\x1c\x00\x00\x00\x45\x04\x00\x00\xce\x13\x00\x00"
+            "\x18\x00\x00\x00\x46\x04\x00\x00\xe7\x13\x00\x00\x23\x00\x00\x00"
+            "\x66\x04\x00\x00\x0b\x14\x00\x00\x55\x00\x00\x00\x67\x04\x00\x00"
+            "\x61\x14\x00\x00\x21\x00\x00\x00\x75\x73\x61\x67\x65\x3a\x20\x00"
+            "\x3c\x61\x72\x67\x3e\x00\x70\x6f\x73\x69\x74\x69\x6f\x6e\x61\x6c"
+            "\x20\x61\x72\x67\x75\x6d\x65\x6e\x74\x73\x00\x6f\x70\x74\x69\x6f"
+            "\x6e\x61\x6c\x20\x61\x72\x67\x75\x6d\x65\x6e\x74\x73\x00\x73\x68"
+            "\x6f\x77\x73\x20\x74\x68\x69\x73\x20\x68\x65\x6c\x70\x20\x6d\x65"
+            "\x73\x73\x61\x67\x65\x20\x61\x6e\x64\x20\x65\x78\x69\x74\x73\x00"
+            "\x75\x6e\x72\x65\x63\x6f\x67\x6e\x69\x7a\x65\x64\x20\x61\x72\x67"
+            "\x75\x6d\x65\x6e\x74\x3a\x20\x7b\x30\x7d\x00\x61\x72\x67\x75\x6d"
+            "\x65\x6e\x74\x20\x7b\x30\x7d\x3a\x20\x65\x78\x70\x65\x63\x74\x65"
+            "\x64\x20\x6f\x6e\x65\x20\x61\x72\x67\x75\x6d\x65\x6e\x74\x00\x61"
+            "\x72\x67\x75\x6d\x65\x6e\x74\x20\x7b\x30\x7d\x3a\x20\x76\x61\x6c"
+            "\x75\x65\x20\x77\x61\x73\x20\x6e\x6f\x74\x20\x65\x78\x70\x65\x63"
+            "\x74\x65\x64\x00\x61\x72\x67\x75\x6d\x65\x6e\x74\x20\x7b\x30\x7d"
+            "\x3a\x20\x65\x78\x70\x65\x63\x74\x65\x64\x20\x61\x20\x6e\x75\x6d"
+            "\x62\x65\x72\x00\x61\x72\x67\x75\x6d\x65\x6e\x74\x20\x7b\x30\x7d"
+            "\x3a\x20\x6e\x75\x6d\x62\x65\x72\x20\x6f\x75\x74\x73\x69\x64\x65"
+            "\x20\x6f\x66\x20\x65\x78\x70\x65\x63\x74\x65\x64\x20\x62\x6f\x75"
+            "\x6e\x64\x73\x00\x61\x72\x67\x75\x6d\x65\x6e\x74\x20\x7b\x30\x7d"
+            "\x3a\x20\x76\x61\x6c\x75\x65\x20\x7b\x31\x7d\x20\x69\x73\x20\x6e"
+            "\x6f\x74\x20\x72\x65\x63\x6f\x67\x6e\x69\x7a\x65\x64\x00\x6b\x6e"
+            "\x6f\x77\x6e\x20\x76\x61\x6c\x75\x65\x73\x20\x66\x6f\x72\x20\x7b"
+            "\x30\x7d\x3a\x20\x7b\x31\x7d\x00\x61\x72\x67\x75\x6d\x65\x6e\x74"
+            "\x20\x7b\x30\x7d\x20\x69\x73\x20\x72\x65\x71\x75\x69\x72\x65\x64"
+            "\x00\x7b\x30\x7d\x3a\x20\x65\x72\x72\x6f\x72\x3a\x20\x7b\x31\x7d"
+            "\x00\x54\x72\x61\x6e\x73\x6c\x61\x74\x65\x73\x20\x50\x4f\x2f\x4d"
+            "\x4f\x20\x66\x69\x6c\x65\x20\x74\x6f\x20\x4c\x4e\x47\x20\x66\x69"
+            "\x6c\x65\x2e\x00\x43\x72\x65\x61\x74\x65\x73\x20\x50\x4f\x54\x20"
+            "\x66\x69\x6c\x65\x20\x66\x72\x6f\x6d\x20\x6d\x65\x73\x73\x61\x67"
+            "\x65\x20\x66\x69\x6c\x65\x2e\x00\x43\x72\x65\x61\x74\x65\x73\x20"
+            "\x68\x65\x61\x64\x65\x72\x20\x66\x69\x6c\x65\x20\x66\x72\x6f\x6d"
+            "\x20\x6d\x65\x73\x73\x61\x67\x65\x20\x66\x69\x6c\x65\x2e\x00\x43"
+            "\x72\x65\x61\x74\x65\x73\x20\x50\x79\x74\x68\x6f\x6e\x20\x6d\x6f"
+            "\x64\x75\x6c\x65\x20\x77\x69\x74\x68\x20\x73\x74\x72\x69\x6e\x67"
+            "\x20\x6b\x65\x79\x73\x2e\x00\x43\x72\x65\x61\x74\x65\x73\x20\x43"
+            "\x2b\x2b\x20\x66\x69\x6c\x65\x20\x77\x69\x74\x68\x20\x66\x61\x6c"
+            "\x6c\x62\x61\x63\x6b\x20\x72\x65\x73\x6f\x75\x72\x63\x65\x20\x66"
+            "\x6f\x72\x20\x74\x68\x65\x20\x6d\x65\x73\x73\x61\x67\x65\x20\x66"
+            "\x69\x6c\x65\x2e\x00\x52\x65\x61\x64\x73\x20\x74\x68\x65\x20\x6c"
+            "\x61\x6e\x67\x75\x61\x67\x65\x20\x64\x65\x73\x63\x72\x69\x70\x74"
+            "\x69\x6f\x6e\x20\x66\x69\x6c\x65\x20\x61\x6e\x64\x20\x61\x73\x73"
+            "\x69\x67\x6e\x73\x20\x76\x61\x6c\x75\x65\x73\x20\x74\x6f\x20\x6e"
+            "\x65\x77\x20\x73\x74\x72\x69\x6e\x67\x73\x2e\x00\x55\x73\x65\x73"
+            "\x20\x61\x20\x63\x75\x73\x74\x6f\x6d\x20\x7b\x7b\x6d\x75\x73\x74"
+            "\x61\x63\x68\x65\x7d\x7d\x20\x74\x65\x6d\x70\x6c\x61\x74\x65\x2e"
+            "\x00\x5b\x2d\x68\x5d\x20\x5b\x2d\x2d\x76\x65\x72\x73\x69\x6f\x6e"
+            "\x5d\x20\x5b\x2d\x2d\x73\x68\x61\x72\x65\x20\x3c\x64\x69\x72\x3e"
+            "\x5d\x20\x3c\x63\x6f\x6d\x6d\x61\x6e\x64\x3e\x20\x3c\x73\x6f\x75"
+            "\x72\x63\x65\x3e\x20\x2d\x6f\x20\x3c\x66\x69\x6c\x65\x3e\x20\x5b"
+            "\x3c\x61\x72\x67\x75\x6d\x65\x6e\x74\x73\x3e\x5d\x00\x54\x68\x65"
+            "\x20\x66\x6c\x6f\x77\x20\x66\x6f\x72\x20\x73\x74\x72\x69\x6e\x67"
+            "\x20\x6d\x61\x6e\x61\x67\x65\x6d\x65\x6e\x74\x20\x61\x6e\x64\x20"
+            "\x63\x72\x65\x61\x74\x69\x6f\x6e\x00\x54\x72\x61\x6e\x73\x6c\x61"
+            "\x74\x69\x6f\x6e\x20\x4d\x61\x6e\x61\x67\x65\x72\x00\x54\x72\x61"
+            "\x6e\x73\x6c\x61\x74\x6f\x72\x00\x44\x65\x76\x65\x6c\x6f\x70\x65"
+            "\x72\x20\x28\x63\x6f\x6d\x70\x69\x6c\x69\x6e\x67\x20\x65\x78\x69"
+            "\x73\x74\x69\x6e\x67\x20\x6c\x69\x73\x74\x29\x00\x44\x65\x76\x65"
+            "\x6c\x6f\x70\x65\x72\x20\x28\x61\x64\x64\x69\x6e\x67\x20\x6e\x65"
+            "\x77\x20\x73\x74\x72\x69\x6e\x67\x29\x00\x44\x65\x76\x65\x6c\x6f"
+            "\x70\x65\x72\x20\x28\x72\x65\x6c\x65\x61\x73\x69\x6e\x67\x20\x61"
+            "\x20\x62\x75\x69\x6c\x64\x29\x00\x6b\x6e\x6f\x77\x6e\x20\x63\x6f"
+            "\x6d\x6d\x61\x6e\x64\x73\x00\x63\x6f\x6d\x6d\x61\x6e\x64\x20\x6d"
+            "\x69\x73\x73\x69\x6e\x67\x00\x75\x6e\x6b\x6e\x6f\x77\x6e\x20\x63"
+            "\x6f\x6d\x6d\x61\x6e\x64\x3a\x20\x7b\x30\x7d\x00\x3c\x77\x68\x65"
+            "\x6e\x3e\x00\x3c\x73\x6f\x75\x72\x63\x65\x3e\x00\x3c\x66\x69\x6c"
+            "\x65\x3e\x00\x3c\x68\x6f\x6c\x64\x65\x72\x3e\x00\x3c\x65\x6d\x61"
+            "\x69\x6c\x3e\x00\x3c\x74\x69\x74\x6c\x65\x3e\x00\x3c\x67\x65\x74"
+            "\x74\x65\x78\x74\x20\x66\x69\x6c\x65\x3e\x00\x3c\x64\x69\x72\x3e"
+            "\x00\x73\x68\x6f\x77\x73\x20\x70\x72\x6f\x67\x72\x61\x6d\x20\x76"
+            "\x65\x72\x73\x69\x6f\x6e\x20\x61\x6e\x64\x20\x65\x78\x69\x74\x73"
+            "\x00\x75\x73\x65\x73\x20\x63\x6f\x6c\x6f\x72\x20\x69\x6e\x20\x64"
+            "\x69\x61\x67\x6e\x6f\x73\x74\x69\x63\x73\x3b\x20\x3c\x77\x68\x65"
+            "\x6e\x3e\x20\x69\x73\x20\x27\x6e\x65\x76\x65\x72\x27\x2c\x20\x27"
+            "\x61\x6c\x77\x61\x79\x73\x27\x2c\x20\x6f\x72\x20\x27\x61\x75\x74"
+            "\x6f\x27\x00\x72\x65\x70\x6c\x61\x63\x65\x73\x20\x7b\x30\x7d\x20"
+            "\x61\x73\x20\x6e\x65\x77\x20\x64\x61\x74\x61\x20\x64\x69\x72\x65"
+            "\x63\x74\x6f\x72\x79\x00\x73\x68\x6f\x77\x73\x20\x6d\x6f\x72\x65"
+            "\x20\x69\x6e\x66\x6f\x00\x73\x65\x74\x73\x20\x74\x68\x65\x20\x6e"
+            "\x61\x6d\x65\x20\x6f\x66\x20\x63\x6f\x70\x79\x72\x69\x67\x68\x74"
+            "\x20\x68\x6f\x6c\x64\x65\x72\x00\x73\x65\x74\x73\x20\x74\x68\x65"
+            "\x20\x6e\x61\x6d\x65\x20\x61\x6e\x64\x20\x65\x6d\x61\x69\x6c\x20"
+            "\x61\x64\x64\x72\x65\x73\x73\x20\x6f\x66\x20\x66\x69\x72\x73\x74"
+            "\x20\x61\x75\x74\x68\x6f\x72\x00\x73\x65\x74\x73\x20\x61\x20\x64"
+            "\x65\x73\x63\x72\x69\x70\x74\x69\x76\x65\x20\x74\x69\x74\x6c\x65"
+            "\x20\x66\x6f\x72\x20\x74\x68\x65\x20\x50\x4f\x54\x20\x70\x72\x6f"
+            "\x6a\x65\x63\x74\x00\x69\x6e\x73\x74\x72\x75\x63\x74\x73\x20\x74"
+            "\x68\x65\x20\x53\x74\x72\x69\x6e\x67\x73\x20\x74\x79\x70\x65\x20"
+            "\x74\x6f\x20\x75\x73\x65\x20\x64\x61\x74\x61\x20\x67\x65\x6e\x65"
+            "\x72\x61\x74\x65\x64\x20\x62\x79\x20\x74\x68\x65\x20\x60\x6c\x6e"
+            "\x67\x73\x20\x72\x65\x73\x27\x2e\x00\x72\x65\x70\x6c\x61\x63\x65"
+            "\x73\x20\x6d\x69\x73\x73\x69\x6e\x67\x20\x73\x74\x72\x69\x6e\x67"
+            "\x73\x20\x77\x69\x74\x68\x20\x77\x61\x72\x70\x65\x64\x20\x6f\x6e"
+            "\x65\x73\x3b\x20\x72\x65\x73\x75\x6c\x74\x69\x6e\x67\x20\x73\x74"
+            "\x72\x69\x6e\x67\x73\x20\x61\x72\x65\x20\x61\x6c\x77\x61\x79\x73"
+            "\x20\x73\x69\x6e\x67\x75\x6c\x61\x72\x00\x72\x65\x70\x6c\x61\x63"
+            "\x65\x73\x20\x61\x6c\x6c\x20\x73\x74\x72\x69\x6e\x67\x73\x20\x77"
+            "\x69\x74\x68\x20\x77\x61\x72\x70\x65\x64\x20\x6f\x6e\x65\x73\x3b"
+            "\x20\x70\x6c\x75\x72\x61\x6c\x20\x73\x74\x72\x69\x6e\x67\x73\x20"
+            "\x77\x69\x6c\x6c\x20\x73\x74\x69\x6c\x6c\x20\x62\x65\x20\x70\x6c"
+            "\x75\x72\x61\x6c\x20\x28\x61\x73\x20\x69\x66\x20\x45\x6e\x67\x6c"
+            "\x69\x73\x68\x29\x00\x61\x64\x64\x73\x20\x62\x6c\x6f\x63\x6b\x20"
+            "\x6f\x66\x20\x73\x74\x72\x69\x6e\x67\x73\x20\x77\x69\x74\x68\x20"
+            "\x6b\x65\x79\x20\x6e\x61\x6d\x65\x73\x00\x73\x65\x74\x73\x20\x66"
+            "\x69\x6c\x65\x20\x6e\x61\x6d\x65\x20\x74\x6f\x20\x23\x69\x6e\x63"
+            "\x6c\x75\x64\x65\x20\x69\x6e\x20\x74\x68\x65\x20\x69\x6d\x70\x6c"
+            "\x65\x6d\x65\x6e\x74\x61\x74\x69\x6f\x6e\x20\x6f\x66\x20\x74\x68"
+            "\x65\x20\x52\x65\x73\x6f\x75\x72\x63\x65\x20\x63\x6c\x61\x73\x73"
+            "\x3b\x20\x64\x65\x66\x61\x75\x6c\x74\x73\x20\x74\x6f\x20\x22\x3c"
+            "\x70\x72\x6f\x6a\x65\x63\x74\x3e\x2e\x68\x70\x70\x22\x2e\x00\x73"
+            "\x65\x74\x73\x20\x50\x4f\x54\x20\x66\x69\x6c\x65\x20\x6e\x61\x6d"
+            "\x65\x20\x74\x6f\x20\x77\x72\x69\x74\x65\x20\x72\x65\x73\x75\x6c"
+            "\x74\x73\x20\x74\x6f\x3b\x20\x75\x73\x65\x20\x22\x2d\x22\x20\x66"
+            "\x6f\x72\x20\x73\x74\x61\x6e\x64\x61\x72\x64\x20\x6f\x75\x74\x70"
+            "\x75\x74\x00\x73\x65\x74\x73\x20\x43\x2b\x2b\x20\x68\x65\x61\x64"
+            "\x65\x72\x20\x66\x69\x6c\x65\x20\x6e\x61\x6d\x65\x20\x74\x6f\x20"
+            "\x77\x72\x69\x74\x65\x20\x72\x65\x73\x75\x6c\x74\x73\x20\x74\x6f"
+            "\x3b\x20\x75\x73\x65\x20\x22\x2d\x22\x20\x66\x6f\x72\x20\x73\x74"
+            "\x61\x6e\x64\x61\x72\x64\x20\x6f\x75\x74\x70\x75\x74\x00\x73\x65"
+            "\x74\x73\x20\x43\x2b\x2b\x20\x63\x6f\x64\x65\x20\x66\x69\x6c\x65"
+            "\x20\x6e\x61\x6d\x65\x20\x77\x69\x74\x68\x20\x62\x75\x69\x6c\x74"
+            "\x69\x6e\x20\x73\x74\x72\x69\x6e\x67\x73\x20\x74\x6f\x20\x77\x72"
+            "\x69\x74\x65\x20\x72\x65\x73\x75\x6c\x74\x73\x20\x74\x6f\x3b\x20"
+            "\x75\x73\x65\x20\x22\x2d\x22\x20\x66\x6f\x72\x20\x73\x74\x61\x6e"
+            "\x64\x61\x72\x64\x20\x6f\x75\x74\x70\x75\x74\x00\x73\x65\x74\x73"
+            "\x20\x50\x79\x74\x68\x6f\x6e\x20\x66\x69\x6c\x65\x20\x6e\x61\x6d"
+            "\x65\x20\x74\x6f\x20\x77\x72\x69\x74\x65\x20\x72\x65\x73\x75\x6c"
+            "\x74\x73\x20\x74\x6f\x3b\x20\x75\x73\x65\x20\x22\x2d\x22\x20\x66"
+            "\x6f\x72\x20\x73\x74\x61\x6e\x64\x61\x72\x64\x20\x6f\x75\x74\x70"
+            "\x75\x74\x00\x73\x65\x74\x73\x20\x4c\x4e\x47\x20\x62\x69\x6e\x61"
+            "\x72\x79\x20\x66\x69\x6c\x65\x20\x6e\x61\x6d\x65\x20\x74\x6f\x20"
+            "\x77\x72\x69\x74\x65\x20\x72\x65\x73\x75\x6c\x74\x73\x20\x74\x6f"
+            "\x3b\x20\x75\x73\x65\x20\x22\x2d\x22\x20\x66\x6f\x72\x20\x73\x74"
+            "\x61\x6e\x64\x61\x72\x64\x20\x6f\x75\x74\x70\x75\x74\x00\x73\x65"
+            "\x74\x73\x20\x49\x44\x4c\x20\x6d\x65\x73\x73\x61\x67\x65\x20\x66"
+            "\x69\x6c\x65\x20\x6e\x61\x6d\x65\x20\x74\x6f\x20\x77\x72\x69\x74"
+            "\x65\x20\x72\x65\x73\x75\x6c\x74\x73\x20\x74\x6f\x3b\x20\x69\x74"
+            "\x20\x6d\x61\x79\x20\x62\x65\x20\x74\x68\x65\x20\x73\x61\x6d\x65"
+            "\x20\x61\x73\x20\x69\x6e\x70\x75\x74\x3b\x20\x75\x73\x65\x20\x22"
+            "\x2d\x22\x20\x66\x6f\x72\x20\x73\x74\x61\x6e\x64\x61\x72\x64\x20"
+            "\x6f\x75\x74\x70\x75\x74\x00\x73\x65\x74\x73\x20\x66\x69\x6c\x65"
+            "\x20\x6e\x61\x6d\x65\x20\x74\x6f\x20\x77\x72\x69\x74\x65\x20\x72"
+            "\x65\x73\x75\x6c\x74\x73\x20\x74\x6f\x3b\x20\x75\x73\x65\x20\x22"
+            "\x2d\x22\x20\x66\x6f\x72\x20\x73\x74\x61\x6e\x64\x61\x72\x64\x20"
+            "\x6f\x75\x74\x70\x75\x74\x00\x73\x65\x74\x73\x20\x6d\x65\x73\x73"
+            "\x61\x67\x65\x20\x66\x69\x6c\x65\x20\x6e\x61\x6d\x65\x20\x74\x6f"
+            "\x20\x72\x65\x61\x64\x20\x66\x72\x6f\x6d\x00\x73\x65\x74\x73\x20"
+            "\x47\x65\x74\x54\x65\x78\x74\x20\x6d\x65\x73\x73\x61\x67\x65\x20"
+            "\x66\x69\x6c\x65\x20\x6e\x61\x6d\x65\x20\x74\x6f\x20\x72\x65\x61"
+            "\x64\x20\x66\x72\x6f\x6d\x00\x73\x65\x74\x73\x20\x41\x54\x54\x52"
+            "\x5f\x4c\x41\x4e\x47\x55\x41\x47\x45\x20\x66\x69\x6c\x65\x20\x6e"
+            "\x61\x6d\x65\x20\x77\x69\x74\x68\x20\x6c\x6c\x5f\x43\x43\x20\x28"
+            "\x6c\x61\x6e\x67\x75\x61\x67\x65\x5f\x43\x4f\x55\x4e\x54\x52\x59"
+            "\x29\x20\x6e\x61\x6d\x65\x73\x20\x6c\x69\x73\x74\x00\x61\x64\x64"
+            "\x73\x20\x61\x64\x64\x69\x74\x69\x6f\x6e\x61\x6c\x20\x64\x69\x72"
+            "\x65\x63\x74\x6f\x72\x79\x20\x66\x6f\x72\x20\x74\x65\x6d\x70\x6c"
+            "\x61\x74\x65\x20\x6c\x6f\x6f\x6b\x75\x70\x00\x73\x65\x6c\x65\x63"
+            "\x74\x73\x20\x61\x20\x74\x65\x6d\x70\x6c\x61\x74\x65\x20\x6e\x61"
+            "\x6d\x65\x20\x74\x6f\x20\x75\x73\x65\x20\x66\x6f\x72\x20\x6f\x75"
+            "\x74\x70\x75\x74\x20\x28\x66\x69\x6c\x65\x6e\x61\x6d\x65\x20\x77"
+            "\x69\x74\x68\x6f\x75\x74\x20\x65\x78\x74\x65\x6e\x73\x69\x6f\x6e"
+            "\x29\x00\x73\x65\x74\x73\x20\x61\x64\x64\x69\x74\x69\x6f\x6e\x61"
+            "\x6c\x20\x63\x6f\x6e\x74\x65\x78\x74\x20\x66\x6f\x72\x20\x63\x75"
+            "\x73\x74\x6f\x6d\x20\x6d\x75\x73\x74\x61\x63\x68\x65\x20\x66\x69"
+            "\x6c\x65\x00\x6f\x75\x74\x70\x75\x74\x73\x20\x61\x64\x64\x69\x74"
+            "\x69\x6f\x6e\x61\x6c\x20\x64\x65\x62\x75\x67\x20\x64\x61\x74\x61"
+            "\x00\x3c\x74\x65\x6d\x70\x6c\x61\x74\x65\x3e\x00\x61\x64\x64\x73"
+            "\x20\x62\x6c\x6f\x63\x6b\x20\x6f\x66\x20\x70\x72\x65\x63\x6f\x6d"
+            "\x70\x69\x6c\x65\x64\x20\x74\x65\x6d\x70\x6c\x61\x74\x65\x73\x20"
+            "\x66\x6f\x72\x20\x73\x74\x72\x69\x6e\x67\x73\x20\x77\x69\x74\x68"
+            "\x20\x70\x6c\x61\x63\x65\x68\x6f\x6c\x64\x65\x72\x73\x00\x47\x65"
+            "\x6e\x65\x72\x61\x74\x65\x73\x20\x6d\x65\x73\x73\x61\x67\x65\x20"
+            "\x66\x69\x6c\x65\x20\x77\x69\x74\x68\x20\x74\x72\x61\x6e\x73\x6c"
+            "\x61\x74\x69\x6f\x6e\x73\x20\x66\x6f\x72\x20\x73\x63\x61\x6c\x65"
+            "\x20\x74\x65\x73\x74\x69\x6e\x67\x2e\x00\x73\x65\x74\x73\x20\x74"
+            "\x68\x65\x20\x64\x69\x72\x65\x63\x74\x6f\x72\x79\x20\x74\x6f\x20"
+            "\x77\x72\x69\x74\x65\x20\x67\x65\x6e\x65\x72\x61\x74\x65\x64\x20"
+            "\x66\x69\x6c\x65\x73\x20\x74\x6f\x00\x3c\x6e\x75\x6d\x62\x65\x72"
+            "\x3e\x00\x3c\x6c\x61\x6e\x67\x3e\x00\x73\x65\x74\x73\x20\x74\x68"
+            "\x65\x20\x6e\x75\x6d\x62\x65\x72\x20\x6f\x66\x20\x73\x74\x72\x69"
+            "\x6e\x67\x73\x20\x74\x6f\x20\x67\x65\x6e\x65\x72\x61\x74\x65\x3b"
+            "\x20\x64\x65\x66\x61\x75\x6c\x74\x73\x20\x74\x6f\x20\x31\x30\x30"
+            "\x30\x00\x73\x65\x74\x73\x20\x74\x68\x65\x20\x73\x65\x65\x64\x20"
+            "\x6f\x66\x20\x74\x68\x65\x20\x67\x65\x6e\x65\x72\x61\x74\x6f\x72"
+            "\x3b\x20\x74\x68\x65\x20\x73\x61\x6d\x65\x20\x73\x65\x65\x64\x20"
+            "\x61\x6c\x77\x61\x79\x73\x20\x67\x69\x76\x65\x73\x20\x74\x68\x65"
+            "\x20\x73\x61\x6d\x65\x20\x66\x69\x6c\x65\x73\x00\x73\x65\x74\x73"
+            "\x20\x74\x68\x65\x20\x70\x65\x72\x63\x65\x6e\x74\x61\x67\x65\x20"
+            "\x6f\x66\x20\x73\x74\x72\x69\x6e\x67\x73\x20\x77\x69\x74\x68\x20"
+            "\x70\x6c\x75\x72\x61\x6c\x20\x66\x6f\x72\x6d\x73\x3b\x20\x64\x65"
+            "\x66\x61\x75\x6c\x74\x73\x20\x74\x6f\x20\x31\x30\x00\x73\x65\x74"
+            "\x73\x20\x74\x68\x65\x20\x70\x65\x72\x63\x65\x6e\x74\x61\x67\x65"
+            "\x20\x6f\x66\x20\x73\x74\x72\x69\x6e\x67\x73\x20\x77\x69\x74\x68"
+            "\x20\x68\x65\x6c\x70\x20\x74\x65\x78\x74\x3b\x20\x64\x65\x66\x61"
+            "\x75\x6c\x74\x73\x20\x74\x6f\x20\x38\x30\x00\x73\x65\x74\x73\x20"
+            "\x74\x68\x65\x20\x6d\x61\x78\x69\x6d\x61\x6c\x20\x6c\x65\x6e\x67"
+            "\x74\x68\x20\x6f\x66\x20\x67\x65\x6e\x65\x72\x61\x74\x65\x64\x20"
+            "\x6b\x65\x79\x73\x3b\x20\x64\x65\x66\x61\x75\x6c\x74\x73\x20\x74"
+            "\x6f\x20\x33\x32\x00\x61\x64\x64\x73\x20\x61\x20\x6c\x61\x6e\x67"
+            "\x75\x61\x67\x65\x20\x74\x6f\x20\x67\x65\x6e\x65\x72\x61\x74\x65"
+            "\x20\x50\x4f\x20\x61\x6e\x64\x20\x4d\x4f\x20\x66\x69\x6c\x65\x73"
+            "\x20\x66\x6f\x72\x3b\x20\x6d\x61\x79\x20\x62\x65\x20\x72\x65\x70"
+            "\x65\x61\x74\x65\x64\x00\x69\x6e\x73\x74\x72\x75\x63\x74\x73\x20"
+            "\x74\x68\x65\x20\x53\x74\x72\x69\x6e\x67\x73\x20\x74\x79\x70\x65"
+            "\x20\x74\x6f\x20\x75\x73\x65\x20\x74\x68\x65\x20\x73\x74\x61\x74"
+            "\x69\x63\x20\x74\x61\x62\x6c\x65\x20\x67\x65\x6e\x65\x72\x61\x74"
+            "\x65\x64\x20\x62\x79\x20\x74\x68\x65\x20\x60\x6c\x6e\x67\x73\x20"
+            "\x72\x65\x73\x20\x2d\x2d\x73\x74\x61\x74\x69\x63\x27\x3b\x20\x69"
+            "\x6d\x70\x6c\x69\x65\x73\x20\x2d\x2d\x72\x65\x73\x6f\x75\x72\x63"
+            "\x65\x00\x77\x72\x69\x74\x65\x73\x20\x73\x74\x72\x69\x6e\x67\x73"
+            "\x20\x61\x73\x20\x61\x20\x73\x74\x61\x74\x69\x63\x20\x74\x61\x62"
+            "\x6c\x65\x2c\x20\x77\x68\x69\x63\x68\x20\x6e\x65\x65\x64\x73\x20"
+            "\x6e\x6f\x20\x70\x61\x72\x73\x69\x6e\x67\x20\x61\x74\x20\x73\x74"
+            "\x61\x72\x74\x75\x70\x2c\x20\x69\x6e\x73\x74\x65\x61\x64\x20\x6f"
+            "\x66\x20\x61\x20\x62\x69\x6e\x61\x72\x79\x20\x72\x65\x73\x6f\x75"
+            "\x72\x63\x65\x00\x77\x72\x69\x74\x65\x73\x20\x61\x20\x73\x74\x72"
+            "\x69\x6e\x67\x20\x66\x6f\x72\x20\x65\x76\x65\x72\x79\x20\x69\x64"
+            "\x20\x6f\x66\x20\x74\x68\x65\x20\x6d\x65\x73\x73\x61\x67\x65\x20"
+            "\x66\x69\x6c\x65\x2c\x20\x69\x6e\x20\x74\x68\x65\x20\x6f\x72\x64"
+            "\x65\x72\x20\x65\x78\x70\x65\x63\x74\x65\x64\x20\x62\x79\x20\x60"
+            "\x6c\x6e\x67\x73\x20\x65\x6e\x75\x6d\x73\x20\x2d\x2d\x64\x65\x6e"
+            "\x73\x65\x27\x00\x61\x64\x64\x73\x20\x70\x6f\x73\x69\x74\x69\x6f"
+            "\x6e\x73\x20\x6f\x66\x20\x74\x68\x65\x20\x73\x74\x72\x69\x6e\x67"
+            "\x73\x20\x69\x6e\x20\x66\x69\x6c\x65\x73\x20\x6d\x61\x64\x65\x20"
+            "\x62\x79\x20\x60\x6c\x6e\x67\x73\x20\x6d\x61\x6b\x65\x20\x2d\x2d"
+            "\x64\x65\x6e\x73\x65\x27\x2c\x20\x73\x6f\x20\x74\x68\x65\x79\x20"
+            "\x61\x72\x65\x20\x66\x6f\x75\x6e\x64\x20\x77\x69\x74\x68\x6f\x75"
+            "\x74\x20\x61\x20\x73\x65\x61\x72\x63\x68\x00\x61\x64\x64\x73\x20"
+            "\x61\x20\x6d\x61\x70\x20\x66\x72\x6f\x6d\x20\x6b\x65\x79\x73\x20"
+            "\x74\x6f\x20\x69\x64\x73\x2c\x20\x77\x68\x69\x63\x68\x20\x6c\x65"
+            "\x74\x73\x20\x74\x72\x2e\x67\x65\x74\x3c\x22\x4b\x45\x59\x22\x3e"
+            "\x28\x29\x20\x66\x69\x6e\x64\x20\x73\x74\x72\x69\x6e\x67\x73\x20"
+            "\x62\x79\x20\x6b\x65\x79\x20\x61\x74\x20\x63\x6f\x6d\x70\x69\x6c"
+            "\x65\x20\x74\x69\x6d\x65\x00\x63\x6f\x6d\x70\x69\x6c\x65\x73\x20"
+            "\x74\x68\x65\x20\x50\x6c\x75\x72\x61\x6c\x2d\x46\x6f\x72\x6d\x73"
+            "\x20\x6f\x66\x20\x74\x68\x65\x20\x6d\x65\x73\x73\x61\x67\x65\x20"
+            "\x66\x69\x6c\x65\x20\x69\x6e\x74\x6f\x20\x61\x20\x43\x2b\x2b\x20"
+            "\x66\x75\x6e\x63\x74\x69\x6f\x6e\x2c\x20\x75\x73\x65\x64\x20\x69"
+            "\x6e\x73\x74\x65\x61\x64\x20\x6f\x66\x20\x70\x61\x72\x73\x69\x6e"
+            "\x67\x20\x74\x68\x65\x20\x72\x75\x6c\x65\x20\x61\x74\x20\x72\x75"
+            "\x6e\x74\x69\x6d\x65\x3b\x20\x6d\x61\x79\x20\x62\x65\x20\x72\x65"
+            "\x70\x65\x61\x74\x65\x64\x00\x62\x75\x69\x6c\x64\x73\x20\x6f\x6e"
+            "\x65\x20\x4c\x4e\x47\x20\x66\x69\x6c\x65\x20\x66\x6f\x72\x20\x65"
+            "\x76\x65\x72\x79\x20\x47\x65\x74\x54\x65\x78\x74\x20\x6d\x65\x73"
+            "\x73\x61\x67\x65\x20\x66\x69\x6c\x65\x20\x69\x6e\x20\x74\x68\x65"
+            "\x20\x64\x69\x72\x65\x63\x74\x6f\x72\x79\x2c\x20\x69\x6e\x73\x74"
+            "\x65\x61\x64\x20\x6f\x66\x20\x74\x68\x65\x20\x73\x69\x6e\x67\x6c"
+            "\x65\x20\x66\x69\x6c\x65\x20\x67\x69\x76\x65\x6e\x20\x62\x79\x20"
+            "\x2d\x6d\x00\x73\x65\x74\x73\x20\x74\x68\x65\x20\x64\x69\x72\x65"
+            "\x63\x74\x6f\x72\x79\x20\x74\x6f\x20\x77\x72\x69\x74\x65\x20\x4c"
+            "\x4e\x47\x20\x66\x69\x6c\x65\x73\x20\x62\x75\x69\x6c\x74\x20\x66"
+            "\x72\x6f\x6d\x20\x74\x68\x65\x20\x2d\x2d\x6d\x73\x67\x73\x2d\x64"
+            "\x69\x72\x20\x66\x69\x6c\x65\x73\x20\x74\x6f\x00\x73\x65\x74\x73"
+            "\x20\x74\x68\x65\x20\x6e\x75\x6d\x62\x65\x72\x20\x6f\x66\x20\x6d"
+            "\x65\x73\x73\x61\x67\x65\x20\x66\x69\x6c\x65\x73\x20\x62\x75\x69"
+            "\x6c\x74\x20\x61\x74\x20\x74\x68\x65\x20\x73\x61\x6d\x65\x20\x74"
+            "\x69\x6d\x65\x3b\x20\x64\x65\x66\x61\x75\x6c\x74\x73\x20\x74\x6f"
+            "\x20\x74\x68\x65\x20\x6e\x75\x6d\x62\x65\x72\x20\x6f\x66\x20\x70"
+            "\x72\x6f\x63\x65\x73\x73\x6f\x72\x73\x00\x61\x72\x67\x75\x6d\x65"
+            "\x6e\x74\x73\x20\x7b\x30\x7d\x20\x61\x6e\x64\x20\x7b\x31\x7d\x20"
+            "\x63\x61\x6e\x6e\x6f\x74\x20\x62\x65\x20\x75\x73\x65\x64\x20\x74"
+            "\x6f\x67\x65\x74\x68\x65\x72\x00\x43\x72\x65\x61\x74\x65\x73\x20"
+            "\x61\x6e\x79\x20\x6f\x66\x20\x74\x68\x65\x20\x68\x65\x61\x64\x65"
+            "\x72\x2c\x20\x72\x65\x73\x6f\x75\x72\x63\x65\x2c\x20\x50\x4f\x54"
+            "\x20\x61\x6e\x64\x20\x50\x79\x74\x68\x6f\x6e\x20\x66\x69\x6c\x65"
+            "\x73\x20\x66\x72\x6f\x6d\x20\x6d\x65\x73\x73\x61\x67\x65\x20\x66"
+            "\x69\x6c\x65\x20\x61\x74\x20\x6f\x6e\x63\x65\x2e\x00\x77\x72\x69"
+            "\x74\x65\x73\x20\x62\x75\x69\x6c\x74\x69\x6e\x20\x73\x74\x72\x69"
+            "\x6e\x67\x73\x20\x61\x73\x20\x61\x20\x73\x74\x61\x74\x69\x63\x20"
+            "\x74\x61\x62\x6c\x65\x20\x61\x6e\x64\x20\x69\x6e\x73\x74\x72\x75"
+            "\x63\x74\x73\x20\x74\x68\x65\x20\x53\x74\x72\x69\x6e\x67\x73\x20"
+            "\x74\x79\x70\x65\x20\x74\x6f\x20\x75\x73\x65\x20\x69\x74\x00\x61"
+            "\x74\x20\x6c\x65\x61\x73\x74\x20\x6f\x6e\x65\x20\x6f\x66\x20\x2d"
+            "\x2d\x65\x6e\x75\x6d\x73\x2c\x20\x2d\x2d\x72\x65\x73\x2c\x20\x2d"
+            "\x2d\x70\x6f\x74\x20\x6f\x72\x20\x2d\x2d\x70\x79\x20\x69\x73\x20"
+            "\x72\x65\x71\x75\x69\x72\x65\x64\x00\x6e\x6f\x74\x65\x00\x77\x61"
+            "\x72\x6e\x69\x6e\x67\x00\x65\x72\x72\x6f\x72\x00\x66\x61\x74\x61"
+            "\x6c\x00\x63\x6f\x75\x6c\x64\x20\x6e\x6f\x74\x20\x6f\x70\x65\x6e"
+            "\x20\x60\x7b\x30\x7d\x27\x00\x63\x6f\x75\x6c\x64\x20\x6e\x6f\x74"
+            "\x20\x6f\x70\x65\x6e\x20\x74\x68\x65\x20\x66\x69\x6c\x65\x00\x60"
+            "\x7b\x30\x7d\x27\x20\x69\x73\x20\x6e\x6f\x74\x20\x73\x74\x72\x69"
+            "\x6e\x67\x73\x20\x66\x69\x6c\x65\x00\x6e\x6f\x20\x6e\x65\x77\x20"
+            "\x73\x74\x72\x69\x6e\x67\x73\x00\x61\x74\x74\x72\x69\x62\x75\x74"
+            "\x65\x20\x60\x7b\x30\x7d\x27\x20\x73\x68\x6f\x75\x6c\x64\x20\x6e"
+            "\x6f\x74\x20\x62\x65\x20\x65\x6d\x70\x74\x79\x00\x61\x74\x74\x72"
+            "\x69\x62\x75\x74\x65\x20\x60\x7b\x30\x7d\x27\x20\x69\x73\x20\x6d"
+            "\x69\x73\x73\x69\x6e\x67\x00\x72\x65\x71\x75\x69\x72\x65\x64\x20"
+            "\x61\x74\x74\x72\x69\x62\x75\x74\x65\x20\x60\x7b\x30\x7d\x27\x20"
+            "\x69\x73\x20\x6d\x69\x73\x73\x69\x6e\x67\x00\x62\x65\x66\x6f\x72"
+            "\x65\x20\x66\x69\x6e\x61\x6c\x69\x7a\x69\x6e\x67\x20\x61\x20\x76"
+            "\x61\x6c\x75\x65\x2c\x20\x75\x73\x65\x20\x60\x69\x64\x28\x2d\x31"
+            "\x29\x27\x00\x65\x78\x70\x65\x63\x74\x65\x64\x20\x7b\x30\x7d\x2c"
+            "\x20\x67\x6f\x74\x20\x7b\x31\x7d\x00\x75\x6e\x72\x65\x63\x6f\x67"
+            "\x6e\x69\x7a\x65\x64\x20\x74\x65\x78\x74\x00\x65\x6e\x64\x20\x6f"
+            "\x66\x20\x66\x69\x6c\x65\x00\x65\x6e\x64\x20\x6f\x66\x20\x6c\x69"
+            "\x6e\x65\x00\x73\x74\x72\x69\x6e\x67\x00\x6e\x75\x6d\x62\x65\x72"
+            "\x00\x69\x64\x65\x6e\x74\x69\x66\x69\x65\x72\x00\x65\x6e\x64\x20"
+            "\x6f\x66\x20\x66\x69\x6c\x65\x00\x65\x6e\x64\x20\x6f\x66\x20\x6c"
+            "\x69\x6e\x65\x00\x73\x74\x72\x69\x6e\x67\x00\x6e\x75\x6d\x62\x65"
+            "\x72\x00\x69\x64\x65\x6e\x74\x69\x66\x69\x65\x72\x00\x6d\x65\x73"
+            "\x73\x61\x67\x65\x20\x66\x69\x6c\x65\x20\x64\x6f\x65\x73\x20\x6e"
+            "\x6f\x74\x20\x63\x6f\x6e\x74\x61\x69\x6e\x20\x74\x72\x61\x6e\x73"
+            "\x6c\x61\x74\x69\x6f\x6e\x20\x66\x6f\x72\x20\x22\x7b\x30\x7d\x22"
+            "\x00\x6d\x65\x73\x73\x61\x67\x65\x20\x66\x69\x6c\x65\x20\x64\x6f"
+            "\x65\x73\x20\x6e\x6f\x74\x20\x63\x6f\x6e\x74\x61\x69\x6e\x20\x4c"
+            "\x61\x6e\x67\x75\x61\x67\x65\x20\x61\x74\x74\x72\x69\x62\x75\x74"
+            "\x65\x00\x6c\x6f\x63\x61\x6c\x65\x20\x7b\x30\x7d\x20\x68\x61\x73"
+            "\x20\x6e\x6f\x20\x6e\x61\x6d\x65\x00\x6e\x6f\x20\x7b\x30\x7d\x20"
+            "\x6c\x6f\x63\x61\x6c\x65\x20\x6f\x6e\x20\x74\x68\x65\x20\x6c\x69"
+            "\x73\x74\x00\x67\x65\x74\x74\x65\x78\x74\x20\x66\x69\x6c\x65\x20"
+            "\x66\x6f\x72\x6d\x61\x74\x20\x65\x72\x72\x6f\x72\x00\x74\x77\x6f"
+            "\x20\x6f\x72\x20\x6d\x6f\x72\x65\x20\x62\x6c\x6f\x63\x6b\x73\x20"
+            "\x6f\x63\x63\x75\x70\x79\x20\x74\x68\x65\x20\x73\x61\x6d\x65\x20"
+            "\x73\x70\x61\x63\x65\x00\x73\x74\x72\x69\x6e\x67\x20\x6e\x6f\x74"
+            "\x20\x63\x6f\x6e\x74\x61\x69\x6e\x65\x64\x20\x69\x6e\x73\x69\x64"
+            "\x65\x20\x74\x68\x65\x20\x62\x6c\x6f\x63\x6b\x00\x66\x69\x6c\x65"
+            "\x20\x74\x72\x75\x6e\x63\x61\x74\x65\x64\x3b\x20\x64\x61\x74\x61"
+            "\x20\x6d\x69\x73\x73\x69\x6e\x67\x00\x73\x74\x72\x69\x6e\x67\x73"
+            "\x20\x6d\x75\x73\x74\x20\x65\x6e\x64\x20\x77\x69\x74\x68\x20\x61"
+            "\x20\x7a\x65\x72\x6f\x00\x75\x6e\x72\x65\x63\x6f\x67\x6e\x69\x7a"
+            "\x65\x64\x20\x66\x69\x65\x6c\x64\x20\x60\x7b\x30\x7d\x27\x00\x75"
+            "\x6e\x72\x65\x63\x6f\x67\x6e\x69\x7a\x65\x64\x20\x65\x73\x63\x61"
+            "\x70\x65\x20\x73\x65\x71\x75\x65\x6e\x63\x65\x20\x60\x5c\x7b\x30"
+            "\x7d\x27\x00\x50\x6c\x75\x72\x61\x6c\x2d\x46\x6f\x72\x6d\x73\x20"
+            "\x6f\x66\x20\x74\x68\x69\x73\x20\x66\x69\x6c\x65\x20\x63\x61\x6e"
+            "\x6e\x6f\x74\x20\x62\x65\x20\x63\x6f\x6d\x70\x69\x6c\x65\x64\x3b"
+            "\x20\x74\x68\x65\x20\x72\x75\x6c\x65\x20\x77\x69\x6c\x6c\x20\x62"
+            "\x65\x20\x69\x6e\x74\x65\x72\x70\x72\x65\x74\x65\x64\x20\x61\x74"
+            "\x20\x72\x75\x6e\x74\x69\x6d\x65\x00\x6e\x6f\x20\x47\x65\x74\x54"
+            "\x65\x78\x74\x20\x6d\x65\x73\x73\x61\x67\x65\x20\x66\x69\x6c\x65"
+            "\x73\x20\x69\x6e\x20\x60\x7b\x30\x7d\x27\x00\x00\x6c\x61\x73\x74"
+            "\x00\x00\x00\x00"
         }; // __resource
     } // namespace
 
@@ -177,7 +177,7 @@ namespace lngs::app {
 
 	mstch::map str_transform::from(idl_string const& str) const {
 		return {
-		    {"key", str.key},
+		    {"key", std::string{str.key}},
 		    {"value", (*value)(str.value)},
 		    {"help", (*help)(str.help)},
 		    {"plural", (*plural)(str.plural)},
@@ -233,7 +233,7 @@ namespace lngs::app {
 		}
 
 		{
-			std::vector<std::string> ids;
+			std::vector<std::string_view> ids;
 			ids.reserve(defs.strings.size());
 			transform(begin(defs.strings), end(defs.strings),
 			          back_inserter(ids), [](auto& str) { return str.key; });
@@ -248,9 +248,9 @@ namespace lngs::app {
 			}
 		}
 
-		append(ctx, "project", defs.project);
-		append(ctx, "version", defs.version);
-		append(ctx, "ns_name", defs.ns_name);
+		append(ctx, "project", std::string{defs.project});
+		append(ctx, "version", std::string{defs.version});
+		append(ctx, "ns_name", std::string{defs.ns_name});
 		append(ctx, "serial", std::to_string(defs.serial));
 
 		append(ctx, "with_singular", !singular.empty());
@@ -0,0 +1,34 @@
+// Copyright (c) 2026 midnightBITS
+// This code is licensed under MIT license (see LICENSE for details)
+
+#include <lngs/internals/commands.hpp>
+
+#include <algorithm>
+#include <atomic>
+#include <thread>
+
+namespace lngs::app {
+	void parallel_for(std::size_t count,
+	                  unsigned jobs,
+	                  std::function<void(std::size_t)> const& task) {
+		if (!jobs) jobs = std::max(1u, std::thread::hardware_concurrency());
+		auto const threads = std::min<std::size_t>(jobs, count);
+
+		std::atomic<std::size_t> next{0};
+		auto const worker = [&] {
+			for (auto index = next.fetch_add(1); index < count;
+			     index = next.fetch_add(1))
+				task(index);
+		};
+
+		if (threads < 2) return worker();
+
+		std::vector<std::thread> pool;
+		pool.reserve(threads - 1);
+		for (std::size_t index = 1; index < threads; ++index)
+			pool.emplace_back(worker);
+		worker();
+		for (auto& thread : pool)
+			thread.join();
+	}
+}  // namespace lngs::app
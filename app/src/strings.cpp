@@ -2,22 +2,16 @@
 // This code is licensed under MIT license (see LICENSE for details)
 
 #include <assert.h>
+#include <algorithm>
 #include <cctype>
+#include <cstring>
 
 #include <lngs/internals/diagnostics.hpp>
 #include <lngs/internals/strings.hpp>
 
 namespace lngs::app {
 	namespace {
-		constexpr std::byte operator""_b(char c) {
-			return static_cast<std::byte>(c);
-		}
-
 		unsigned char s2uc(char c) { return static_cast<unsigned char>(c); }
-
-		unsigned char b2uc(std::byte b) {
-			return static_cast<unsigned char>(b);
-		}
 	}  // namespace
 
 	enum tok_t {
@@ -39,7 +33,7 @@ namespace lngs::app {
 
 	struct token {
 		tok_t type;
-		std::string value;
+		std::string_view value;
 		diags::location start_pos;
 		diags::location end_pos;
 		int file_offset;
@@ -94,8 +88,9 @@ namespace lngs::app {
 				case NUMBER:
 					return lng::ERR_EXPECTED_NUMBER;
 				case ID:
-					return value.empty() ? lng::ERR_EXPECTED_ID
-					                     : argument{"`" + value + "'"};
+					return value.empty()
+					           ? lng::ERR_EXPECTED_ID
+					           : argument{"`" + std::string{value} + "'"};
 				default:
 					break;
 			}
@@ -116,8 +111,9 @@ namespace lngs::app {
 				case NUMBER:
 					return lng::ERR_EXPECTED_GOT_NUMBER;
 				case ID:
-					return value.empty() ? lng::ERR_EXPECTED_GOT_ID
-					                     : argument{"`" + value + "'"};
+					return value.empty()
+					           ? lng::ERR_EXPECTED_GOT_ID
+					           : argument{"`" + std::string{value} + "'"};
 				default:
 					break;
 			}
@@ -127,11 +123,24 @@ namespace lngs::app {
 		}
 	};
 
+	std::string_view idl_arena::store(std::string_view text) {
+		if (text.empty()) return {};
+		auto const ptr = static_cast<char*>(resource_.allocate(text.size(), 1));
+		std::memcpy(ptr, text.data(), text.size());
+		return {ptr, text.size()};
+	}
+
+	// Scans a copy of the source, kept in the arena, from the current
+	// position of the source. Token values are views of that copy or, for
+	// the strings with escape sequences, of their unescaped text, stored in
+	// the same arena.
 	class tokenizer {
 		diags::source_code& in_;
+		idl_arena& arena_;
+		std::string_view text_;
+		std::size_t pos_ = 0;
 		unsigned line_ = 1;
 		unsigned column_ = 1;
-		int file_offset_ = 0;
 
 		bool peeked_ = false;
 		bool eof_ = false;
@@ -139,23 +148,32 @@ namespace lngs::app {
 		token next_;
 
 		char nextc() {
-			char c;
-			auto size = in_.read(&c, 1);
-			if (!size) {
+			if (pos_ == text_.size()) {
 				eof_ = true;
 				return 0;
 			}
-			++file_offset_;
 			++column_;
-			return c;
+			return text_[pos_++];
+		}
+		char peekc() const noexcept {
+			return pos_ < text_.size() ? text_[pos_] : 0;
 		}
 		void set_next(int offset, tok_t tok);
-		void set_next(int offset, const std::string& value, tok_t tok);
+		void set_next(int offset, std::string_view value, tok_t tok);
 		void ws_comments();
+		void read_quoted(int offset);
 		void read();
 
 	public:
-		tokenizer(diags::source_code& in) : in_(in) {}
+		tokenizer(diags::source_code& in, idl_arena& arena)
+		    : in_(in), arena_(arena) {
+			auto const& contents = in_.data();
+			text_ = arena_.store(
+			    {reinterpret_cast<char const*>(contents.data()),
+			     contents.size()});
+			text_ = text_.substr(
+			    std::min(text_.size(), static_cast<std::size_t>(in_.tell())));
+		}
 
 		tokenizer(const tokenizer&) = delete;
 		tokenizer& operator=(const tokenizer&) = delete;
@@ -166,6 +184,7 @@ namespace lngs::app {
 
 		const token& peek();
 		token get();
+		std::string_view get_string();
 
 		bool expect(tok_t type, bool fatal, diags::sources& diag);
 		bool expect(tok_t first, tok_t second, diags::sources& diag);
@@ -178,12 +197,13 @@ namespace lngs::app {
 
 	void tokenizer::set_next(int offset, tok_t tok) {
 		next_.type = tok;
+		next_.value = {};
 		next_.start_pos = start_pos_;
 		next_.end_pos = position();
 		next_.file_offset = offset;
 	}
 
-	void tokenizer::set_next(int offset, const std::string& value, tok_t tok) {
+	void tokenizer::set_next(int offset, std::string_view value, tok_t tok) {
 		next_.type = tok;
 		next_.value = value;
 		next_.start_pos = start_pos_;
@@ -196,7 +216,7 @@ namespace lngs::app {
 
 		do {
 			found_comment = false;
-			while (!eof_ && std::isspace(b2uc(in_.peek()))) {
+			while (pos_ < text_.size() && std::isspace(s2uc(text_[pos_]))) {
 				auto c = nextc();
 				if (c == '\n') {
 					++line_;
@@ -204,12 +224,15 @@ namespace lngs::app {
 				}
 			}
 
-			if (eof_ || in_.peek() != '/'_b) break;
+			if (peekc() != '/') break;
 			nextc();
 
-			if (!eof_ && in_.peek() == '/'_b) {
-				while (!eof_ && in_.peek() != '\n'_b)
-					nextc();
+			if (peekc() == '/') {
+				auto const end = text_.find('\n', pos_);
+				auto const length =
+				    (end == std::string_view::npos ? text_.size() : end) - pos_;
+				column_ += static_cast<unsigned>(length);
+				pos_ += length;
 
 				found_comment = true;
 			}
@@ -219,10 +242,83 @@ namespace lngs::app {
 		start_pos_ = position();
 	}
 
+	void tokenizer::read_quoted(int offset) {
+		// the common case, nothing to unescape: the value is a view of the
+		// text between the quotes
+		auto const start = pos_;
+		auto stop = start;
+		while (stop < text_.size() && text_[stop] != '"' &&
+		       text_[stop] != '\\')
+			++stop;
+
+		column_ += static_cast<unsigned>(stop - start);
+		pos_ = stop;
+		if (stop < text_.size() && text_[stop] == '"') {
+			nextc();
+			return set_next(offset, text_.substr(start, stop - start),
+			                STRING);
+		}
+
+		bool escaping = false;
+		bool instring = true;
+		std::string s{text_.substr(start, stop - start)};
+		while (!eof_ && instring) {
+			auto c = nextc();
+			if (eof_) break;
+
+			if (escaping) {
+				switch (c) {
+					case 'a':
+						s.push_back('\a');
+						break;
+					case 'b':
+						s.push_back('\b');
+						break;
+					case 'f':
+						s.push_back('\f');
+						break;
+					case 'n':
+						s.push_back('\n');
+						break;
+					case 'r':
+						s.push_back('\r');
+						break;
+					case 't':
+						s.push_back('\t');
+						break;
+					case 'v':
+						s.push_back('\v');
+						break;
+					case '\n':
+						++line_;
+						column_ = 1;
+						break;
+					default:
+						s.push_back(c);
+				};
+				escaping = false;
+			} else {
+				switch (c) {
+					case '\\':
+						escaping = true;
+						break;
+					case '"':
+						instring = false;
+						break;
+					default:
+						s.push_back(c);
+				}
+			}
+		}
+
+		set_next(offset, arena_.store(s), STRING);
+	}
+
 	void tokenizer::read() {
 		ws_comments();
 
-		auto offset = file_offset_;
+		auto const offset = static_cast<int>(pos_);
+		auto const start = pos_;
 		auto c = nextc();
 		if (eof_) return set_next(offset, END_OF_FILE);
 
@@ -245,85 +341,27 @@ namespace lngs::app {
 				return set_next(offset, SEMI);
 			case ',':
 				return set_next(offset, COMMA);
-			case '"': {
-				bool escaping = false;
-				bool instring = true;
-				std::string s;
-				while (!eof_ && instring) {
-					c = nextc();
-					if (eof_) break;
-
-					if (escaping) {
-						switch (c) {
-							case 'a':
-								s.push_back('\a');
-								break;
-							case 'b':
-								s.push_back('\b');
-								break;
-							case 'f':
-								s.push_back('\f');
-								break;
-							case 'n':
-								s.push_back('\n');
-								break;
-							case 'r':
-								s.push_back('\r');
-								break;
-							case 't':
-								s.push_back('\t');
-								break;
-							case 'v':
-								s.push_back('\v');
-								break;
-							case '\n':
-								++line_;
-								column_ = 1;
-								break;
-							default:
-								s.push_back(c);
-						};
-						escaping = false;
-					} else {
-						switch (c) {
-							case '\\':
-								escaping = true;
-								break;
-							case '"':
-								instring = false;
-								break;
-							default:
-								s.push_back(c);
-						}
-					}
-				}
-				return set_next(offset, s, STRING);
-			}
+			case '"':
+				return read_quoted(offset);
 			default:
 				if (std::isdigit(s2uc(c)) || c == '-' || c == '+') {
 					if (c == '-' || c == '+') {
-						if (eof_ || !std::isdigit(b2uc(in_.peek()))) break;
+						if (!std::isdigit(s2uc(peekc()))) break;
 					}
 
-					std::string s;
-					s.push_back(c);
+					while (std::isdigit(s2uc(peekc())))
+						nextc();
 
-					while (!eof_ && std::isdigit(b2uc(in_.peek()))) {
-						s.push_back(nextc());
-					}
-
-					return set_next(offset, s, NUMBER);
+					return set_next(offset, text_.substr(start, pos_ - start),
+					                NUMBER);
 				}
 
 				if (c == '_' || std::isalpha(s2uc(c))) {
-					std::string s;
-					s.push_back(c);
-					while (!eof_ && (std::isalnum(b2uc(in_.peek())) ||
-					                 in_.peek() == '_'_b)) {
-						s.push_back(nextc());
-					}
+					while (std::isalnum(s2uc(peekc())) || peekc() == '_')
+						nextc();
 
-					return set_next(offset, s, ID);
+					return set_next(offset, text_.substr(start, pos_ - start),
+					                ID);
 				}
 		}
 
@@ -344,6 +382,17 @@ namespace lngs::app {
 		return std::move(next_);
 	}
 
+	// Reads a string and all the strings directly following it as one value.
+	std::string_view tokenizer::get_string() {
+		auto value = get().value;
+		if (peek().type != STRING) return value;
+
+		std::string joined{value};
+		while (peek().type == STRING)
+			joined.append(get().value);
+		return arena_.store(joined);
+	}
+
 	bool tokenizer::expect(tok_t type, bool fatal, diags::sources& diag) {
 		auto& t = peek();
 		if (type == t.type) return true;
@@ -411,8 +460,7 @@ namespace lngs::app {
 
 	struct store_attr_base : attr {
 		virtual tok_t primary() const noexcept = 0;
-		virtual void visit(const token& tok, const std::string& /*arg*/) = 0;
-		virtual void prepare() = 0;
+		virtual void visit(const token& tok, std::string_view /*arg*/) = 0;
 	};
 
 #if USE_SET_ATTR
@@ -452,24 +500,16 @@ namespace lngs::app {
 	};
 
 	template <typename T>
-	void store(T& dst, const std::string& src) {
+	void store(T& dst, std::string_view src) {
 		dst = src;
 	}
 
-	void store(std::string& dst, const std::string& src) {
-		dst.append(src);
+	void store(int& dst, std::string_view src) {
+		dst = atoi(std::string{src}.c_str());
 	}
 
-	void store(int& dst, const std::string& src) { dst = atoi(src.c_str()); }
-
-	void store(uint32_t& dst, const std::string& src) {
-		dst = static_cast<uint32_t>(atoi(src.c_str()));
-	}
-
-	template <typename T>
-	void clear(T const&) {}
-	void clear(std::string& dst) {
-		dst.clear();
+	void store(uint32_t& dst, std::string_view src) {
+		dst = static_cast<uint32_t>(atoi(std::string{src}.c_str()));
 	}
 
 	template <typename T>
@@ -491,14 +531,10 @@ namespace lngs::app {
 				return STRING;
 		}
 
-		void visit(const token& tok, const std::string& arg) override {
+		void visit(const token& tok, std::string_view arg) override {
 			store(*ptr, arg);
 			visited(tok, true);
 		}
-
-		void prepare() override {
-			clear(*ptr);
-		}
 	};
 
 #if USE_SET_ATTR
@@ -571,15 +607,7 @@ namespace lngs::app {
 				auto& val = tok.peek();
 				switch (val.type) {
 					case STRING:
-						store.prepare();
-						store.visit(name, val.value);
-						tok.get();
-
-						while (tok.peek().type == STRING) {
-							auto continuation = tok.get();
-							store.visit(name, continuation.value);
-						}
-
+						store.visit(name, tok.get_string());
 						if (!tok.expect(BRAKET_C, true, diag)) return false;
 						tok.get();
 						break;
@@ -711,13 +739,7 @@ namespace lngs::app {
 		tok.get();
 
 		if (!tok.expect(STRING, true, diag)) return false;
-		auto value = tok.get();
-		str.value = value.value;
-
-		while (tok.peek().type == STRING) {
-			auto continuation = tok.get();
-			str.value.append(continuation.value);
-		}
+		str.value = tok.get_string();
 
 		if (!tok.expect(SEMI, true, diag)) return false;
 		tok.get();
@@ -728,7 +750,7 @@ namespace lngs::app {
 	bool read_strings(diags::source_code in,
 	                  idl_strings& def,
 	                  diags::sources& diag) {
-		tokenizer tok{in};
+		tokenizer tok{in, *def.arena};
 
 		if (!tok.expect(SQBRAKET_O, ID, diag)) {  // '[' or `strings'
 			return false;
@@ -0,0 +1,449 @@
+// Copyright (c) 2026 midnightBITS
+// This code is licensed under MIT license (see LICENSE for details)
+
+#include <lngs/internals/synth.hpp>
+
+#include <algorithm>
+#include <cctype>
+#include <cstddef>
+#include <utility>
+
+namespace lngs::app::synth {
+	namespace {
+		// splitmix64; the standard distributions are implementation-defined,
+		// which would make the output differ between compilers
+		class random {
+			uint64_t state;
+
+		public:
+			explicit random(uint64_t seed) noexcept : state{seed} {}
+
+			uint64_t next() noexcept {
+				state += 0x9E3779B97F4A7C15ull;
+				auto z = state;
+				z = (z ^ (z >> 30)) * 0xBF58476D1CE4E5B9ull;
+				z = (z ^ (z >> 27)) * 0x94D049BB133111EBull;
+				return z ^ (z >> 31);
+			}
+
+			unsigned below(unsigned max) noexcept {
+				if (!max) return 0;
+				return static_cast<unsigned>(next() >> 32) % max;
+			}
+
+			bool percent(unsigned share) noexcept { return below(100) < share; }
+
+			template <typename T, std::size_t N>
+			T const& pick(T const (&items)[N]) noexcept {
+				return items[below(static_cast<unsigned>(N))];
+			}
+		};
+
+		uint64_t mix(uint64_t seed, std::string_view salt, std::size_t index) {
+			// FNV-1a over the salt, so each language gets its own stream
+			uint64_t hash = 0xcbf29ce484222325ull;
+			for (auto c : salt) {
+				hash ^= static_cast<unsigned char>(c);
+				hash *= 0x100000001b3ull;
+			}
+			return seed ^ hash ^ (uint64_t{index} * 0x9E3779B97F4A7C15ull);
+		}
+
+		constexpr std::string_view words[] = {
+		    "file",     "open",      "could",   "not",      "the",
+		    "string",   "value",     "argument", "missing", "expected",
+		    "number",   "directory", "name",    "project",  "version",
+		    "template", "output",    "input",   "message",  "language",
+		    "error",    "warning",   "note",    "sets",     "creates",
+		    "reads",    "writes",    "list",    "header",   "resource",
+		    "a",        "an",        "of",      "for",      "with",
+		    "to",       "from",      "in",      "on",       "is",
+		};
+
+		// some syllables are multi-byte, to have UTF-8 in the translations
+		constexpr std::string_view syllables[] = {
+		    "ka", "lo", "mi", "ne", "ra", "to", "shi", "zu", "wa",  "be",
+		    "do", "gę", "ść", "ła", "ży", "ö",  "ä",   "ü",  "é",   "ñ",
+		    "os", "an", "el", "ir", "un", "ed", "ja",  "pr", "str", "nt",
+		};
+
+		std::string sentence(random& rng,
+		                     unsigned min_words,
+		                     unsigned max_words) {
+			std::string result;
+			auto const count = min_words + rng.below(max_words - min_words + 1);
+			for (unsigned index = 0; index < count; ++index) {
+				if (index) result.push_back(' ');
+				result.append(rng.pick(words));
+			}
+			return result;
+		}
+
+		std::string pseudo_word(random& rng) {
+			std::string result;
+			auto const count = 1 + rng.below(4);
+			for (unsigned index = 0; index < count; ++index)
+				result.append(rng.pick(syllables));
+			return result;
+		}
+
+		// puts the placeholders between the words of the text, in random
+		// order, like a translator would
+		std::string with_placeholders(random& rng,
+		                              std::vector<std::string> list,
+		                              unsigned placeholders) {
+			for (unsigned arg = 0; arg < placeholders; ++arg) {
+				auto const at =
+				    rng.below(static_cast<unsigned>(list.size()) + 1);
+				list.insert(list.begin() + static_cast<std::ptrdiff_t>(at),
+				            "{" + std::to_string(arg) + "}");
+			}
+
+			std::string result;
+			for (auto const& word : list) {
+				if (!result.empty()) result.push_back(' ');
+				result.append(word);
+			}
+			return result;
+		}
+
+		unsigned placeholders_of(std::string_view value) {
+			unsigned count = 0;
+			while (value.find("{" + std::to_string(count) + "}") !=
+			       std::string_view::npos)
+				++count;
+			return count;
+		}
+
+		std::string original(random& rng, unsigned placeholders) {
+			std::vector<std::string> list;
+			auto const count = 1 + rng.below(12);
+			for (unsigned index = 0; index < count; ++index)
+				list.emplace_back(rng.pick(words));
+			return with_placeholders(rng, std::move(list), placeholders);
+		}
+
+		std::string translated(random& rng, unsigned placeholders) {
+			std::vector<std::string> list;
+			auto const count = 1 + rng.below(14);
+			for (unsigned index = 0; index < count; ++index)
+				list.push_back(pseudo_word(rng));
+			return with_placeholders(rng, std::move(list), placeholders);
+		}
+
+		std::string key(random& rng, std::size_t index, unsigned max_length) {
+			auto const suffix = "_" + std::to_string(index);
+			auto const min_length = std::min(8u, max_length);
+			auto const length =
+			    min_length + rng.below(max_length - min_length + 1);
+
+			std::string result;
+			while (true) {
+				auto const word = rng.pick(words);
+				auto const extra = word.size() + (result.empty() ? 0 : 1);
+				if (result.size() + extra + suffix.size() > length) break;
+				if (!result.empty()) result.push_back('_');
+				for (auto c : word)
+					result.push_back(static_cast<char>(
+					    std::toupper(static_cast<unsigned char>(c))));
+			}
+			if (result.empty()) result.push_back('S');
+			return result + suffix;
+		}
+
+		std::vector<std::string> translations(idl_string const& str,
+		                                      std::size_t index,
+		                                      language const& lang,
+		                                      uint64_t seed) {
+			random rng{mix(seed, lang.code, index)};
+			auto const placeholders = placeholders_of(str.value);
+			auto const forms = str.plural.empty() ? 1u : lang.nplurals;
+
+			std::vector<std::string> result;
+			result.reserve(forms);
+			for (unsigned form = 0; form < forms; ++form)
+				result.push_back(translated(rng, placeholders));
+			return result;
+		}
+
+		std::string header(idl_strings const& defs, language const& lang) {
+			std::string result = "Project-Id-Version: ";
+			result.append(defs.project);
+			result.push_back(' ');
+			result.append(defs.version);
+			result.append("\nLanguage: ");
+			result.append(lang.code);
+			result.append(
+			    "\nMIME-Version: 1.0\n"
+			    "Content-Type: text/plain; charset=UTF-8\n"
+			    "Content-Transfer-Encoding: 8bit\n"
+			    "Plural-Forms: ");
+			result.append(lang.plural_forms);
+			result.push_back('\n');
+			return result;
+		}
+
+		void append_quoted(std::string& out, std::string_view text) {
+			out.push_back('"');
+			for (auto c : text) {
+				switch (c) {
+					case '"':
+					case '\\':
+						out.push_back('\\');
+						out.push_back(c);
+						break;
+					case '\n':
+						out.append("\\n");
+						break;
+					default:
+						out.push_back(c);
+				}
+			}
+			out.push_back('"');
+		}
+
+		void append_le(std::string& out, uint32_t value) {
+			for (int shift = 0; shift < 32; shift += 8)
+				out.push_back(static_cast<char>((value >> shift) & 0xFF));
+		}
+	}  // namespace
+
+	std::vector<language> const& known_languages() {
+		static std::vector<language> const langs{
+		    {"ar", 6,
+		     "nplurals=6; plural=(n==0 ? 0 : n==1 ? 1 : n==2 ? 2 : n%100>=3 "
+		     "&& n%100<=10 ? 3 : n%100>=11 ? 4 : 5);"},
+		    {"cs", 3,
+		     "nplurals=3; plural=(n==1) ? 0 : (n>=2 && n<=4) ? 1 : 2;"},
+		    {"de", 2, "nplurals=2; plural=(n != 1);"},
+		    {"en", 2, "nplurals=2; plural=(n != 1);"},
+		    {"es", 2, "nplurals=2; plural=(n != 1);"},
+		    {"fr", 2, "nplurals=2; plural=(n > 1);"},
+		    {"ga", 5,
+		     "nplurals=5; plural=n==1 ? 0 : n==2 ? 1 : (n>2 && n<7) ? 2 :(n>6 "
+		     "&& n<11) ? 3 : 4;"},
+		    {"it", 2, "nplurals=2; plural=(n != 1);"},
+		    {"ja", 1, "nplurals=1; plural=0;"},
+		    {"ko", 1, "nplurals=1; plural=0;"},
+		    {"lt", 3,
+		     "nplurals=3; plural=(n%10==1 && n%100!=11 ? 0 : n%10>=2 && "
+		     "(n%100<10 || n%100>=20) ? 1 : 2);"},
+		    {"lv", 3,
+		     "nplurals=3; plural=(n%10==1 && n%100!=11 ? 0 : n != 0 ? 1 : "
+		     "2);"},
+		    {"nl", 2, "nplurals=2; plural=(n != 1);"},
+		    {"pl", 3,
+		     "nplurals=3; plural=(n==1 ? 0 : n%10>=2 && n%10<=4 && (n%100<10 "
+		     "|| n%100>=20) ? 1 : 2);"},
+		    {"pt_BR", 2, "nplurals=2; plural=(n > 1);"},
+		    {"ro", 3,
+		     "nplurals=3; plural=(n==1 ? 0 : (n==0 || (n%100 > 0 && n%100 < "
+		     "20)) ? 1 : 2);"},
+		    {"ru", 3,
+		     "nplurals=3; plural=(n%10==1 && n%100!=11 ? 0 : n%10>=2 && "
+		     "n%10<=4 && (n%100<10 || n%100>=20) ? 1 : 2);"},
+		    {"sk", 3,
+		     "nplurals=3; plural=(n==1) ? 0 : (n>=2 && n<=4) ? 1 : 2;"},
+		    {"sl", 4,
+		     "nplurals=4; plural=(n%100==1 ? 0 : n%100==2 ? 1 : n%100==3 || "
+		     "n%100==4 ? 2 : 3);"},
+		    {"sv", 2, "nplurals=2; plural=(n != 1);"},
+		    {"tr", 2, "nplurals=2; plural=(n != 1);"},
+		    {"uk", 3,
+		     "nplurals=3; plural=(n%10==1 && n%100!=11 ? 0 : n%10>=2 && "
+		     "n%10<=4 && (n%100<10 || n%100>=20) ? 1 : 2);"},
+		    {"zh_CN", 1, "nplurals=1; plural=0;"},
+		};
+		return langs;
+	}
+
+	language find_language(std::string_view code) {
+		for (auto const& lang : known_languages()) {
+			if (lang.code == code) return lang;
+		}
+		return {code, 2, "nplurals=2; plural=(n != 1);"};
+	}
+
+	idl_strings make_strings(options const& opts) {
+		random rng{opts.seed};
+
+		idl_strings defs{};
+		defs.project = "synth";
+		defs.version = "1.0";
+		defs.ns_name = "synth";
+		defs.serial = static_cast<uint32_t>(opts.seed & 0x7FFF'FFFF);
+		defs.strings.reserve(opts.strings);
+
+		auto id = 1001;
+		for (std::size_t index = 0; index < opts.strings; ++index) {
+			auto& str = defs.strings.emplace_back();
+			str.key = defs.arena->store(key(rng, index, opts.key_length));
+
+			auto const plural = rng.percent(opts.plurals);
+			auto const placeholders =
+			    plural ? 1 + rng.below(2) : rng.below(100) < 30 ? 1u : 0u;
+			str.value = defs.arena->store(original(rng, placeholders));
+			if (plural)
+				str.plural = defs.arena->store(original(rng, placeholders));
+			if (rng.percent(opts.helps)) {
+				str.help = defs.arena->store("Describes " +
+				                             sentence(rng, 2, 16));
+			}
+			str.id = str.original_id = id++;
+		}
+
+		return defs;
+	}
+
+	std::string make_idl(idl_strings const& defs) {
+		std::string out = "[\n\tproject(";
+		append_quoted(out, defs.project);
+		out.append("),\n\tnamespace(");
+		append_quoted(out, defs.ns_name);
+		out.append("),\n\tversion(");
+		append_quoted(out, defs.version);
+		out.append("),\n\tserial(");
+		out.append(std::to_string(defs.serial));
+		out.append(")\n] strings {\n");
+
+		for (auto const& str : defs.strings) {
+			out.append("\t[");
+			if (!str.help.empty()) {
+				out.append("help(");
+				append_quoted(out, str.help);
+				out.append("), ");
+			}
+			if (!str.plural.empty()) {
+				out.append("plural(");
+				append_quoted(out, str.plural);
+				out.append("), ");
+			}
+			out.append("id(");
+			out.append(std::to_string(str.id));
+			out.append(")]\n\t");
+			out.append(str.key);
+			out.append(" = ");
+			append_quoted(out, str.value);
+			out.append(";\n");
+		}
+
+		out.append("}\n");
+		return out;
+	}
+
+	std::string make_po(idl_strings const& defs,
+	                    language const& lang,
+	                    uint64_t seed) {
+		std::string out = "msgid \"\"\nmsgstr \"\"\n";
+		auto const hdr = header(defs, lang);
+		std::string_view view{hdr};
+		while (!view.empty()) {
+			auto const pos = std::min(view.find('\n'), view.size() - 1);
+			append_quoted(out, view.substr(0, pos + 1));
+			out.push_back('\n');
+			view = view.substr(pos + 1);
+		}
+
+		std::size_t index = 0;
+		for (auto const& str : defs.strings) {
+			auto const forms = translations(str, index++, lang, seed);
+
+			out.push_back('\n');
+			if (!str.help.empty()) {
+				out.append("#. ");
+				out.append(str.help);
+				out.push_back('\n');
+			}
+			out.append("msgctxt ");
+			append_quoted(out, str.key);
+			out.append("\nmsgid ");
+			append_quoted(out, str.value);
+			out.push_back('\n');
+
+			if (str.plural.empty()) {
+				out.append("msgstr ");
+				append_quoted(out, forms.front());
+				out.push_back('\n');
+				continue;
+			}
+
+			out.append("msgid_plural ");
+			append_quoted(out, str.plural);
+			out.push_back('\n');
+			std::size_t form = 0;
+			for (auto const& text : forms) {
+				out.append("msgstr[");
+				out.append(std::to_string(form++));
+				out.append("] ");
+				append_quoted(out, text);
+				out.push_back('\n');
+			}
+		}
+
+		return out;
+	}
+
+	std::string make_mo(idl_strings const& defs,
+	                    language const& lang,
+	                    uint64_t seed) {
+		std::vector<std::pair<std::string, std::string>> entries;
+		entries.reserve(defs.strings.size() + 1);
+		entries.emplace_back(std::string{}, header(defs, lang));
+
+		std::size_t index = 0;
+		for (auto const& str : defs.strings) {
+			auto msgid = std::string{str.key};
+			msgid.push_back('\x04');
+			msgid.append(str.value);
+			if (!str.plural.empty()) {
+				msgid.push_back(0);
+				msgid.append(str.plural);
+			}
+
+			std::string msgstr;
+			for (auto const& text : translations(str, index++, lang, seed)) {
+				if (!msgstr.empty()) msgstr.push_back(0);
+				msgstr.append(text);
+			}
+			entries.emplace_back(std::move(msgid), std::move(msgstr));
+		}
+
+		// gettext looks the originals up with a binary search
+		std::sort(entries.begin(), entries.end());
+
+		constexpr uint32_t ints_in_header = 7;
+		auto const count = static_cast<uint32_t>(entries.size());
+		auto const table = count * 2 * uint32_t{sizeof(uint32_t)};
+		auto const originals = ints_in_header * uint32_t{sizeof(uint32_t)};
+		auto const translated = originals + table;
+		auto offset = translated + table;
+
+		std::string out;
+		out.reserve(offset);
+		append_le(out, 0x950412de);
+		append_le(out, 0);
+		append_le(out, count);
+		append_le(out, originals);
+		append_le(out, translated);
+		append_le(out, 0);  // no hash table
+		append_le(out, offset);
+
+		std::string data;
+		auto const write_table = [&](auto member) {
+			for (auto const& entry : entries) {
+				auto const& text = entry.*member;
+				auto const length = static_cast<uint32_t>(text.size());
+				append_le(out, length);
+				append_le(out, offset);
+				data.append(text);
+				data.push_back(0);
+				offset += length + 1;
+			}
+		};
+		write_table(&std::pair<std::string, std::string>::first);
+		write_table(&std::pair<std::string, std::string>::second);
+
+		out.append(data);
+		return out;
+	}
+}  // namespace lngs::app::synth
@@ -444,4 +444,122 @@ namespace name::sub {
 	};
 
 	INSTANTIATE_TEST_SUITE_P(sources, enums, ValuesIn(sources));
+
+	TEST(enums_dense, slots) {
+		diags::sources diag;
+		diag.set_contents("", R"([serial(3), project("name")]
+strings {
+	[id(1004)] ID4 = "value4";
+	[id(1001), plural("values")] ID = "value";
+	[id(1002)] ID2 = "value2";
+})");
+
+		test_env<outstrstream> data{};
+		bool idl_valid = read_strings(diag.source(""), data.strings, diag);
+		EXPECT_TRUE(idl_valid);
+
+		app::enums::write(data.env(), false, false, true);
+		EXPECT_EQ(R"(// THIS FILE IS AUTOGENERATED
+#pragma once
+
+#include <lngs/lngs.hpp>
+
+// clang-format off
+namespace name {
+    enum class lng {
+        /// value4
+        ID4 = 1004,
+        /// value2
+        ID2 = 1002,
+    }; // enum class lng
+
+    enum class counted {
+        /// value | values
+        ID = 1001,
+    }; // enum class counted
+
+    // Slots of the strings in files made with "lngs make --dense".
+    namespace dense {
+        constexpr uint32_t first_id = 1001;
+        constexpr uint32_t slots[] = {
+            0, // 1001
+            1, // 1002
+            lngs::no_slot, // 1003
+            2, // 1004
+        }; // slots
+    } // namespace dense
+
+    constexpr lngs::lang_file::slot slot_of(lng val) noexcept {
+        return lngs::slot_in(dense::slots, dense::first_id, val);
+    }
+
+    constexpr lngs::lang_file::slot slot_of(counted val) noexcept {
+        return lngs::slot_in(dense::slots, dense::first_id, val);
+    }
+
+    using Strings = lngs::StringsWithPlurals<lng, counted, lngs::VersionedFile<3>>;
+} // namespace name
+// clang-format on
+)",
+		          data.output.contents);
+	}
+
+	TEST(enums_keys, map) {
+		diags::sources diag;
+		diag.set_contents("", R"([serial(3), project("name")]
+strings {
+	[id(1004)] ID4 = "value4";
+	[id(1001), plural("values")] ID = "value";
+	[id(1002)] ID2 = "value2";
+})");
+
+		test_env<outstrstream> data{};
+		bool idl_valid = read_strings(diag.source(""), data.strings, diag);
+		EXPECT_TRUE(idl_valid);
+
+		app::enums::write(data.env(), false, false, false, true);
+		EXPECT_EQ(R"(// THIS FILE IS AUTOGENERATED
+#pragma once
+
+#include <lngs/lngs.hpp>
+
+// clang-format off
+namespace name {
+    enum class lng {
+        /// value4
+        ID4 = 1004,
+        /// value2
+        ID2 = 1002,
+    }; // enum class lng
+
+    enum class counted {
+        /// value | values
+        ID = 1001,
+    }; // enum class counted
+
+    // Ids of the strings, sorted by their keys, for tr.get<"KEY">().
+    namespace keys {
+        constexpr lngs::key_entry<lng> singular[] = {
+            {"ID2", lng::ID2},
+            {"ID4", lng::ID4},
+        }; // singular
+        constexpr lngs::key_entry<counted> plural[] = {
+            {"ID", counted::ID},
+        }; // plural
+    } // namespace keys
+
+    constexpr auto const& keys_of(lngs::key_tag<lng>) noexcept {
+        return keys::singular;
+    }
+
+    constexpr auto const& keys_of(lngs::key_tag<counted>) noexcept {
+        return keys::plural;
+    }
+
+    using Strings = lngs::StringsWithPlurals<lng, counted, lngs::VersionedFile<3>>;
+} // namespace name
+// clang-format on
+)",
+		          data.output.contents);
+	}
 }  // namespace lngs::app::testing
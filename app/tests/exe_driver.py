@@ -78,6 +78,49 @@ def diff(expected, actual):
     return "".join(list(unified_diff(expected, actual))[2:])
 
 
+def expand(arg):
+    return arg.replace("$DATA", datadir)
+
+
+# Each entry of "compare" names a file written by the tested command, which
+# has to be the same, byte for byte, as the file another run of the tool
+# writes; with "patched", the test's patches are applied to both first.
+def compare_outputs(comparisons, patches):
+    errors = []
+    for item in comparisons:
+        args = [expand(arg) for arg in item["args"]]
+        proc = subprocess.run([driven, *args], capture_output=True, env=env)
+        if proc.returncode:
+            errors.append(
+                f"{shlex.join([driven, *args])} returned {proc.returncode}\n"
+                f"{proc.stderr.decode('UTF-8', 'replace')}"
+            )
+            continue
+
+        contents = []
+        for name in (item["same-as"], item["file"]):
+            try:
+                with open(expand(name), "rb") as f:
+                    contents.append(f.read())
+            except OSError as ex:
+                errors.append(str(ex))
+        if len(contents) < 2:
+            continue
+
+        expected, actual = contents
+        if item.get("patched", False):
+            expected = fix(expected, patches, False)
+            actual = fix(actual, patches, False)
+        if expected == actual:
+            continue
+
+        message = f"{item['file']} differs from {item['same-as']}"
+        if isinstance(expected, str):
+            message += f"\nDiff:\n{diff(expected, actual)}"
+        errors.append(message)
+    return errors
+
+
 for filename in sorted(testsuite):
     counter += 1
     with open(filename) as f:
@@ -94,7 +137,7 @@ for filename in sorted(testsuite):
 
     env["LANGUAGE"] = lang
 
-    expanded = [arg.replace("$DATA", datadir) for arg in args]
+    expanded = [expand(arg) for arg in args]
 
     print(f"[{counter:>{digits}}/{len(testsuite)}] {repr(name)}")
     proc = subprocess.run([driven, *expanded], capture_output=True, env=env)
@@ -103,12 +146,13 @@ for filename in sorted(testsuite):
         fix(proc.stdout, patches, has_sources),
         fix(proc.stderr, patches, False),
     ]
+    mismatched = compare_outputs(data.get("compare", []), patches)
     if expected is None:
         data["expected"] = actual
         with open(filename, "w") as f:
             json.dump(data, f, separators=(", ", ": "))
         print(f"[{counter:>{digits}}/{len(testsuite)}] {repr(name)} saved")
-    elif actual == expected:
+    elif actual == expected and not mismatched:
         print(f"[{counter:>{digits}}/{len(testsuite)}] {repr(name)} PASSED")
     elif skippable:
         print(f"[{counter:>{digits}}/{len(testsuite)}] {repr(name)} SKIPPED")
@@ -123,6 +167,8 @@ for filename in sorted(testsuite):
                     print(
                         f"{flds[ndx]}\n  Expected:\n    {repr(expected[ndx])}\n  Actual:\n    {repr(actual[ndx])}"
                     )
+        for message in mismatched:
+            print(message)
         print(" ".join([shlex.quote(arg) for arg in [driven, *expanded]]))
         print(f"[{counter:>{digits}}/{len(testsuite)}] {repr(name)} **FAILED**")
         had_errors = True
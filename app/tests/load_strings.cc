@@ -477,6 +477,15 @@ namespace lngs::app::testing {
 	                            "value \" with quotation",
 	                            HelpStr{"escaped \\ string"})
 	                    .offset(23))},
+	    {R"([serial(0)] strings { [id(-1), help("escaped\tand" " plain")] ID = "tab\t" "plain " "new\nline"; })",
+	     {},
+	     true,
+	     basic.make(test_string(1001,
+	                            -1,
+	                            "ID",
+	                            "tab\tplain new\nline",
+	                            HelpStr{"escaped\tand plain"})
+	                    .offset(23))},
 	    {R"([serial(0)] strings { [id(-1), help("removed EOL")] ID = "multi \
 line"; })",
 	     {},
@@ -681,4 +690,26 @@ after";
 	};
 
 	INSTANTIATE_TEST_SUITE_P(files, read_file, ValuesIn(files));
+
+	TEST(read_arena, outlives_sources) {
+		idl_strings actual;
+		{
+			sources diag;
+			diag.set_contents(source_filename,
+			                  R"([serial(1)] strings {
+	[id(1001)] PLAIN = "plain";
+	[id(1002)] ESCAPED = "tab\t" "joined";
+})");
+			ASSERT_TRUE(
+			    read_strings(diag.source(source_filename), actual, diag));
+		}
+
+		auto const copy = actual;
+		actual = {};
+		ASSERT_EQ(2u, copy.strings.size());
+		EXPECT_EQ("PLAIN"sv, copy.strings[0].key);
+		EXPECT_EQ("plain"sv, copy.strings[0].value);
+		EXPECT_EQ("ESCAPED"sv, copy.strings[1].key);
+		EXPECT_EQ("tab\tjoined"sv, copy.strings[1].value);
+	}
 }  // namespace lngs::app::testing
\ No newline at end of file
@@ -0,0 +1,59 @@
+#include <gtest/gtest.h>
+#include <lngs/internals/commands.hpp>
+#include <atomic>
+#include <string>
+#include <vector>
+
+extern std::filesystem::path TESTING_data_path;
+
+namespace lngs::app::testing {
+	TEST(make_batch, items) {
+		auto const msgs = TESTING_data_path / "batch";
+		std::error_code ec;
+		auto const items = make::batch_items(msgs, "out", ec);
+		ASSERT_FALSE(ec) << ec.message();
+		ASSERT_EQ(2u, items.size());
+		EXPECT_EQ(msgs / "en.po", items[0].msgs);
+		EXPECT_EQ(std::filesystem::path{"out"} / "en.lng", items[0].lng);
+		EXPECT_EQ(msgs / "pl.mo", items[1].msgs);
+		EXPECT_EQ(std::filesystem::path{"out"} / "pl.lng", items[1].lng);
+	}
+
+	TEST(make_batch, items_sorted) {
+		auto const msgs = TESTING_data_path / "batch-diags";
+		std::error_code ec;
+		auto const items = make::batch_items(msgs, "out", ec);
+		ASSERT_FALSE(ec) << ec.message();
+		ASSERT_EQ(4u, items.size());
+		char const* names[] = {"de", "en", "fr", "pl"};
+		for (std::size_t index = 0; index < items.size(); ++index) {
+			auto const name = std::string{names[index]};
+			EXPECT_EQ(msgs / (name + ".po"), items[index].msgs);
+			EXPECT_EQ(std::filesystem::path{"out"} / (name + ".lng"),
+			          items[index].lng);
+		}
+	}
+
+	TEST(make_batch, no_dir) {
+		std::error_code ec;
+		auto const items =
+		    make::batch_items(TESTING_data_path / "nothing", "out", ec);
+		EXPECT_TRUE(ec);
+		EXPECT_TRUE(items.empty());
+	}
+
+	TEST(parallel_for, every_index_once) {
+		for (unsigned jobs : {0u, 1u, 3u, 64u}) {
+			for (std::size_t count : {0u, 1u, 5u, 100u}) {
+				std::vector<std::atomic<int>> calls(count);
+				parallel_for(count, jobs, [&](std::size_t index) {
+					calls[index].fetch_add(1);
+				});
+				for (std::size_t index = 0; index < count; ++index)
+					EXPECT_EQ(1, calls[index].load())
+					    << "jobs: " << jobs << ", count: " << count
+					    << ", index: " << index;
+			}
+		}
+	}
+}  // namespace lngs::app::testing
@@ -300,7 +300,7 @@ namespace lngs::app::testing {
 		auto [input, include, project, expected] = GetParam();
 
 		test_env<outstrstream> data{};
-		data.strings.project.assign(project);
+		data.strings.project = project;
 		res::update_and_write(data.env(), input, include);
 		EXPECT_EQ(expected, data.output.contents);
 	}
@@ -312,7 +312,7 @@ namespace lngs::app::testing {
 		const auto pos2 = expected.find("}; // resource", pos1);
 
 		test_env<partial_ostrstream> data{{pos1 + (pos2 - pos1) / 2}};
-		data.strings.project.assign(project);
+		data.strings.project = project;
 		res::update_and_write(data.env(), input, include);
 		EXPECT_EQ(expected.substr(0, data.output.chars), data.output.contents);
 	}
@@ -323,7 +323,7 @@ namespace lngs::app::testing {
 		const auto pos = expected.find("const char resource[] = {") + 30;
 
 		test_env<partial_ostrstream> data{{pos}};
-		data.strings.project.assign(project);
+		data.strings.project = project;
 		res::update_and_write(data.env(), input, include);
 		EXPECT_EQ(expected.substr(0, data.output.chars), data.output.contents);
 	}
@@ -336,7 +336,7 @@ namespace lngs::app::testing {
 		const auto pos = expected.rfind("\"\n", pos2);
 
 		test_env<partial_ostrstream> data{{pos}};
-		data.strings.project.assign(project);
+		data.strings.project = project;
 		res::update_and_write(data.env(), input, include);
 		EXPECT_EQ(expected.substr(0, data.output.chars), data.output.contents);
 	}
@@ -348,7 +348,7 @@ namespace lngs::app::testing {
 		const auto pos = expected.find("\"\n", pos1) + 1;
 
 		test_env<partial_ostrstream> data{{pos}};
-		data.strings.project.assign(project);
+		data.strings.project = project;
 		res::update_and_write(data.env(), input, include);
 		EXPECT_EQ(expected.substr(0, data.output.chars), data.output.contents);
 	}
@@ -545,6 +545,107 @@ namespace project {
 
 	INSTANTIATE_TEST_SUITE_P(resources, res_write, ValuesIn(write_resources));
 
+	TEST(res_static, string_literal) {
+		EXPECT_EQ(R"({"", 0})", res::string_literal({}));
+		EXPECT_EQ(R"({"value", 5})", res::string_literal("value"));
+		EXPECT_EQ(R"({"a\"b\\c\n", 6})", res::string_literal("a\"b\\c\n"));
+		EXPECT_EQ(R"({"{0} item\000{0} items", 18})",
+		          res::string_literal("{0} item\0{0} items"sv));
+		EXPECT_EQ(R"({"\305\274", 2})", res::string_literal("\xc5\xbc"));
+	}
+
+	TEST(res_static, table) {
+		file input{};
+		input.serial = 1;
+		input.strings = {make_str(1003, "second"), make_str(1001, "first")};
+
+		test_env<outstrstream> data{};
+		data.strings.project = "project";
+		res::update_and_write(data.env(), input, "res.hpp", true);
+		auto const& out = data.output.contents;
+
+		auto const first = out.find(R"({"first", 5})");
+		auto const second = out.find(R"({"second", 6})");
+		ASSERT_NE(std::string::npos, first);
+		ASSERT_NE(std::string::npos, second);
+		EXPECT_LT(first, second);
+		EXPECT_NE(std::string::npos, out.find("1001,\n            1003,"));
+		EXPECT_EQ(std::string::npos, out.find("const char resource[]"));
+	}
+
+	TEST(res_plurals, expression) {
+		EXPECT_EQ("(n != 1)",
+		          res::plural_expression("nplurals=2; plural=(n != 1);"));
+		EXPECT_EQ("n%10==1 && n%100!=11 ? 0 : 1",
+		          res::plural_expression(
+		              "nplurals=2; plural=n%10==1 && n%100!=11 ? 0 : 1;"));
+		EXPECT_EQ("0", res::plural_expression("nplurals=1; plural=0;"));
+
+		EXPECT_EQ("", res::plural_expression(""));
+		EXPECT_EQ("", res::plural_expression("nplurals=2; plural=3/n;"));
+		EXPECT_EQ("", res::plural_expression("nplurals=2; plural=n % 0;"));
+		EXPECT_EQ("", res::plural_expression("nplurals=2; plural=n==010;"));
+		EXPECT_EQ("", res::plural_expression("nplurals=2; plural=n+;"));
+		EXPECT_EQ("", res::plural_expression("nplurals=2; plural=m;"));
+	}
+
+	TEST(res_plurals, native) {
+		diags::sources diag;
+		diag.set_contents("pl.po", R"(msgid ""
+msgstr ""
+"Language: pl\n"
+"Plural-Forms: nplurals=3; plural=(n==1 ? 0 : n%10>=2 && n%10<=4 && "
+"(n%100<10 || n%100>=20) ? 1 : 2);\n"
+)");
+		diag.set_contents("xx.po", R"(msgid ""
+msgstr ""
+"Language: xx\n"
+)");
+
+		auto const pl = res::native_plurals(diag.source("pl.po"), diag);
+		ASSERT_TRUE(pl);
+		EXPECT_EQ("pl", pl->culture);
+		EXPECT_EQ(3, pl->nplurals);
+		EXPECT_EQ(
+		    "(n==1 ? 0 : n%10>=2 && n%10<=4 && (n%100<10 || n%100>=20) ? 1 "
+		    ": 2)",
+		    pl->expression);
+		EXPECT_TRUE(diag.diagnostic_set().empty());
+
+		EXPECT_FALSE(res::native_plurals(diag.source("xx.po"), diag));
+		EXPECT_EQ(1u, diag.diagnostic_set().size());
+		EXPECT_FALSE(diag.has_errors());
+	}
+
+	TEST(res_plurals, write) {
+		file input{};
+		input.serial = 1;
+		input.strings = {make_str(1001, "first")};
+
+		std::vector<res::plural_rule> plurals{
+		    {"pt-BR", "nplurals=2; plural=(n > 1);", 2, "(n > 1)"},
+		    {"pt-BR", "nplurals=2; plural=(n != 1);", 2, "(n != 1)"},
+		};
+
+		test_env<outstrstream> data{};
+		data.strings.project = "project";
+		res::update_and_write(data.env(), input, "res.hpp", true, plurals);
+		auto const& out = data.output.contents;
+
+		EXPECT_NE(std::string::npos, out.find("#include <lngs/plurals.hpp>"));
+		EXPECT_NE(std::string::npos,
+		          out.find("intmax_t plural_pt_BR([[maybe_unused]] intmax_t n) "
+		                   "noexcept {\n        return (n > 1);"));
+		EXPECT_NE(std::string::npos,
+		          out.find("intmax_t plural_pt_BR_2([[maybe_unused]] intmax_t "
+		                   "n) noexcept {\n        return (n != 1);"));
+		EXPECT_NE(std::string::npos,
+		          out.find(R"({ {"pt-BR", 5}, {"nplurals=2; plural=(n > 1);", )"
+		                   R"(27}, 2, plural_pt_BR },)"));
+		EXPECT_NE(std::string::npos,
+		          out.find("native_registrar registrar{native_plurals};"));
+	}
+
 	TEST(res_read, builtin) {
 		SingularStrings<lngs::app::lng, storage::Builtin<Resource>> res;
 		ASSERT_TRUE(res.init_builtin());
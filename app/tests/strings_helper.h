@@ -2,6 +2,13 @@
 #include <lngs/internals/strings.hpp>
 
 namespace lngs::app::testing {
+	// Keeps the text of the expected definitions for the whole test run,
+	// so the strings can be taken out of the idl_strings made below.
+	inline idl_arena& test_arena() {
+		static idl_arena arena{};
+		return arena;
+	}
+
 	template <typename Tag, typename Storage>
 	struct tagged_t {
 		Storage val;
@@ -73,11 +80,12 @@ namespace lngs::app::testing {
 			return std::move(*this);
 		}
 
-		operator idl_string() && {
-			return {std::move(key),
-			        std::move(value),
-			        std::move(help.val),
-			        std::move(plural.val),
+		operator idl_string() const {
+			auto& arena = test_arena();
+			return {arena.store(key),
+			        arena.store(value),
+			        arena.store(help.val),
+			        arena.store(plural.val),
 			        id,
 			        original_id,
 			        id_offset};
@@ -145,9 +153,15 @@ namespace lngs::app::testing {
 
 		template <typename... StringType>
 		idl_strings make(StringType... str) const {
+			auto& arena = test_arena();
 			const auto has_new = ((str.original_id <= 0) || ...);
-			return {project.val,   version.val, ns_name.val,        serial,
-			        serial_offset, has_new,     {std::move(str)...}};
+			return {arena.store(project.val),
+			        arena.store(version.val),
+			        arena.store(ns_name.val),
+			        serial,
+			        serial_offset,
+			        has_new,
+			        {std::move(str)...}};
 		}
 	};
 }  // namespace lngs::app::testing
\ No newline at end of file
@@ -0,0 +1,155 @@
+#include <gtest/gtest.h>
+#include <lngs/internals/commands.hpp>
+#include <lngs/internals/diagnostics.hpp>
+#include <lngs/internals/gettext.hpp>
+#include <lngs/internals/languages.hpp>
+#include <lngs/internals/synth.hpp>
+#include <lngs/lngs_file.hpp>
+#include <algorithm>
+#include <set>
+#include "ostrstream.h"
+
+namespace lngs::app::testing {
+	using ::testing::TestWithParam;
+	using ::testing::ValuesIn;
+	using namespace ::diags;
+
+	synth::options opts(uint64_t seed,
+	                    std::size_t strings,
+	                    unsigned plurals = 20) {
+		synth::options result{};
+		result.seed = seed;
+		result.strings = strings;
+		result.plurals = plurals;
+		return result;
+	}
+
+	TEST(synth, deterministic) {
+		auto const pl = synth::find_language("pl");
+		auto const lhs = synth::make_strings(opts(1234, 500));
+		auto const rhs = synth::make_strings(opts(1234, 500));
+		EXPECT_EQ(synth::make_idl(lhs), synth::make_idl(rhs));
+		EXPECT_EQ(synth::make_po(lhs, pl, 1234), synth::make_po(rhs, pl, 1234));
+		EXPECT_EQ(synth::make_mo(lhs, pl, 1234), synth::make_mo(rhs, pl, 1234));
+
+		auto const other = synth::make_strings(opts(4321, 500));
+		EXPECT_NE(synth::make_idl(lhs), synth::make_idl(other));
+		EXPECT_NE(synth::make_po(lhs, pl, 1234), synth::make_po(lhs, pl, 4321));
+	}
+
+	TEST(synth, shares_and_keys) {
+		auto options = opts(5, 4000, 25);
+		options.helps = 50;
+		options.key_length = 20;
+		auto const defs = synth::make_strings(options);
+		ASSERT_EQ(4000u, defs.strings.size());
+
+		std::set<std::string> keys;
+		std::size_t plurals = 0;
+		std::size_t helps = 0;
+		for (auto const& str : defs.strings) {
+			EXPECT_LE(str.key.size(), 20u) << str.key;
+			keys.insert(std::string{str.key});
+			if (!str.plural.empty()) ++plurals;
+			if (!str.help.empty()) ++helps;
+		}
+		EXPECT_EQ(defs.strings.size(), keys.size());
+		EXPECT_NEAR(1000.0, static_cast<double>(plurals), 150.0);
+		EXPECT_NEAR(2000.0, static_cast<double>(helps), 150.0);
+	}
+
+	TEST(synth, idl_roundtrip) {
+		auto const expected = synth::make_strings(opts(77, 300));
+
+		sources diag;
+		diag.set_contents("", synth::make_idl(expected));
+		idl_strings actual;
+		ASSERT_TRUE(read_strings(diag.source(""), actual, diag));
+
+		EXPECT_EQ(expected.project, actual.project);
+		EXPECT_EQ(expected.version, actual.version);
+		EXPECT_EQ(expected.ns_name, actual.ns_name);
+		EXPECT_EQ(expected.serial, actual.serial);
+		ASSERT_EQ(expected.strings.size(), actual.strings.size());
+		for (std::size_t index = 0; index < actual.strings.size(); ++index) {
+			auto const& exp = expected.strings[index];
+			auto const& act = actual.strings[index];
+			EXPECT_EQ(exp.key, act.key);
+			EXPECT_EQ(exp.value, act.value);
+			EXPECT_EQ(exp.help, act.help);
+			EXPECT_EQ(exp.plural, act.plural);
+			EXPECT_EQ(exp.id, act.id);
+		}
+	}
+
+	class synth_lang : public TestWithParam<std::string_view> {};
+
+	TEST_P(synth_lang, po_and_mo) {
+		auto const lang = synth::find_language(GetParam());
+		auto const defs = synth::make_strings(opts(3, 300));
+
+		sources diag;
+		diag.set_contents("po", synth::make_po(defs, lang, 3));
+		diag.set_contents("mo", synth::make_mo(defs, lang, 3));
+		auto po = diag.source("po");
+		auto mo = diag.source("mo");
+		EXPECT_FALSE(gtt::is_mo(po));
+		EXPECT_TRUE(gtt::is_mo(mo));
+
+		auto const from_po = gtt::open_po(po, diag);
+		auto const from_mo = gtt::open_mo(mo, diag);
+		EXPECT_FALSE(diag.has_errors());
+		EXPECT_EQ(from_po, from_mo);
+		ASSERT_EQ(defs.strings.size() + 1, from_mo.size());
+
+		for (auto const& str : defs.strings) {
+			auto it = from_mo.find(std::string{str.key});
+			ASSERT_NE(from_mo.end(), it) << str.key;
+			auto const forms =
+			    std::count(it->second.begin(), it->second.end(), '\0') + 1;
+			EXPECT_EQ(str.plural.empty() ? 1 : lang.nplurals,
+			          static_cast<unsigned>(forms))
+			    << str.key;
+		}
+	}
+
+	TEST_P(synth_lang, make) {
+		auto const lang = synth::find_language(GetParam());
+		auto const defs = synth::make_strings(opts(11, 300));
+
+		sources diag;
+		diag.set_contents("mo", synth::make_mo(defs, lang, 11));
+		auto file =
+		    make::load_msgs(defs, false, false, diag.source("mo"), diag);
+		EXPECT_FALSE(diag.has_errors());
+		EXPECT_TRUE(diag.diagnostic_set().empty());
+		ASSERT_EQ(defs.strings.size(), file.strings.size());
+
+		outstrstream out;
+		file.write(out);
+
+		lang_file lng;
+		ASSERT_TRUE(lng.open(
+		    {reinterpret_cast<std::byte const*>(out.contents.data()),
+		     out.contents.size()}));
+		EXPECT_EQ(lang.code, lng.get_attr(ATTR_CULTURE));
+		EXPECT_EQ(lang.plural_forms, lng.get_attr(ATTR_PLURALS));
+
+		for (auto const& str : defs.strings) {
+			auto const id = static_cast<lang_file::identifier>(
+			    static_cast<uint32_t>(str.id));
+			EXPECT_FALSE(lng.get_string(id).empty()) << str.key;
+			if (str.plural.empty()) continue;
+			for (intmax_t count : {0, 1, 2, 5, 11, 22, 101}) {
+				EXPECT_FALSE(
+				    lng.get_string(id, lang_file::quantity{count}).empty())
+				    << str.key << " for " << count;
+			}
+		}
+	}
+
+	constexpr std::string_view languages[] = {"ja", "en", "fr", "pl", "ru",
+	                                          "sl", "ga", "ar", "xx"};
+
+	INSTANTIATE_TEST_SUITE_P(languages, synth_lang, ValuesIn(languages));
+}  // namespace lngs::app::testing
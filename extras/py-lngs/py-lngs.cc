@@ -4,43 +4,259 @@
 #include <lngs/lite.h>
 
 #include <algorithm>
+#include <unordered_map>
+
+namespace {
+	PyObject* from_utf8(const char* str, size_t length)
+	{
+#ifdef PY_TWO
+		return PyString_FromStringAndSize(str, (Py_ssize_t)length);
+#else
+		return PyUnicode_DecodeUTF8(str, (Py_ssize_t)length, nullptr);
+#endif
+	}
+
+	bool as_id(PyObject* arg, uint32_t& id)
+	{
+		auto value = PyLong_AsUnsignedLong(arg);
+		if (value == (unsigned long)-1 && PyErr_Occurred())
+			return false;
+		if (value > UINT32_MAX) {
+			PyErr_SetString(PyExc_OverflowError, "string id out of range");
+			return false;
+		}
+		id = (uint32_t)value;
+		return true;
+	}
+
+	bool as_count(PyObject* arg, intmax_t& count)
+	{
+		auto value = PyLong_AsLongLong(arg);
+		if (value == -1 && PyErr_Occurred())
+			return false;
+		count = (intmax_t)value;
+		return true;
+	}
+}
 
 class PyLangFile {
 	HSTRINGS strings;
+#ifndef PY_TWO
+	// object the catalog was opened from, if not opened by path
+	Py_buffer source{};
+#endif
+	// decoded strings: singular ones by id, plural forms by their position
+	// in the file, as one form may be chosen for many counts
+	std::unordered_map<uint32_t, PyObject*> singular;
+	std::unordered_map<const char*, PyObject*> plural;
+
+	template <typename Key>
+	static PyObject* cached(std::unordered_map<Key, PyObject*>& cache, Key key, const char* str, size_t length)
+	{
+		auto it = cache.find(key);
+		if (it == cache.end()) {
+			auto value = from_utf8(str, length);
+			if (!value)
+				return nullptr;
+			it = cache.emplace(key, value).first;
+		}
+		Py_INCREF(it->second);
+		return it->second;
+	}
+
+	PyObject* lookup(uint32_t id)
+	{
+		auto it = singular.find(id);
+		if (it != singular.end()) {
+			Py_INCREF(it->second);
+			return it->second;
+		}
+
+		size_t length = 0;
+		auto str = ReadStringEx(strings, id, &length);
+		if (!str)
+			Py_RETURN_NONE;
+		return cached(singular, id, str, length);
+	}
+
+	PyObject* lookup(uint32_t id, intmax_t count)
+	{
+		size_t length = 0;
+		auto str = ReadStringPlEx(strings, id, count, &length);
+		if (!str)
+			Py_RETURN_NONE;
+		return cached(plural, str, str, length);
+	}
+
+	static bool parse_lookup(PyObject* const* args, Py_ssize_t nargs, const char* usage, uint32_t& id, intmax_t& count)
+	{
+		if (nargs < 1 || nargs > 2) {
+			PyErr_SetString(PyExc_TypeError, usage);
+			return false;
+		}
+
+		// the count goes first, as it always did in get(count, id)
+		if (nargs == 1)
+			return as_id(args[0], id);
+		return as_count(args[0], count) && as_id(args[1], id);
+	}
+
+#ifndef PY_TWO
+	static int get_buffer(PyObject* self, Py_buffer* view, int flags)
+	{
+		if (!Type::check(self)) {
+			view->obj = nullptr;
+			PyErr_SetString(PyExc_BufferError, "not a langs_file");
+			return -1;
+		}
+
+		size_t size = 0;
+		auto data = GetStringsData(Type::extract(self)->strings, &size);
+		return PyBuffer_FillInfo(view, self, const_cast<void*>(data), (Py_ssize_t)size, 1, flags);
+	}
+#endif
+
+	static PyObject* call(PyObject* self, PyObject* args, PyObject*)
+	{
+		if (!Type::check(self))
+			Py_RETURN_NONE;
+		return Type::extract(self)->packed_get(&PyTuple_GET_ITEM(args, 0), PyTuple_GET_SIZE(args));
+	}
+
 public:
 	using Type = ::Type<PyLangFile>;
 	PyLangFile(HSTRINGS strings) : strings(strings)
 	{
 	}
 
+#ifndef PY_TWO
+	PyLangFile(HSTRINGS strings, const Py_buffer& source) : strings(strings), source(source)
+	{
+	}
+#endif
+
 	~PyLangFile()
 	{
+		for (auto& pair : singular)
+			Py_DECREF(pair.second);
+		for (auto& pair : plural)
+			Py_DECREF(pair.second);
 		if (strings)
 			CloseStrings(strings);
+#ifndef PY_TWO
+		if (source.obj)
+			PyBuffer_Release(&source);
+#endif
 	}
 
-	BEGIN_TYPE_MAP("langs_file", "Looks up translated strings in specified file.")
-		TYPE_DEF("__call__", get, "Looks up the translation. Either self(id) or self(id, count), for strings with plural.")
-		TYPE_DEF("get",      get, "Looks up the translation. Either get(id) or get(id, count), for strings with plural.")
+	static void py_slots(PyTypeObject& type)
+	{
+		type.tp_call = call;
+#ifndef PY_TWO
+		static PyBufferProcs buffer = { get_buffer, nullptr };
+		type.tp_as_buffer = &buffer;
+#endif
+	}
+
+	BEGIN_TYPE_MAP_WITH_SLOTS("langs_file", "Looks up translated strings in specified file.")
+		TYPE_DEF_FAST("__call__", get,      "Looks up the translation. Either self(id) or self(count, id), for strings with plural.")
+		TYPE_DEF_FAST("get",      get,      "Looks up the translation. Either get(id) or get(count, id), for strings with plural.")
+		TYPE_DEF_FAST("get_many", get_many, "Looks up translations for a sequence of ids. Either get_many(ids) or get_many(count, ids), for strings with plural. Returns a list.")
+#ifndef PY_TWO
+		TYPE_DEF_FAST("get_bytes", get_bytes, "Looks up the translation, as a read-only memoryview of UTF-8 bytes inside the catalog. Either get_bytes(id) or get_bytes(count, id), for strings with plural.")
+#endif
 	END_TYPE_MAP()
 
-	DEF(get)
+	DEF_FAST(get)
 	{
-		const char* lookup = 0;
-		int id = 0;
-		int count = 0;
+		uint32_t id = 0;
+		intmax_t count = 0;
 
-		if (PyArg_ParseTuple(args, "ii", &count, &id)) {
-			lookup = ReadStringPl(strings, id, count);
-		} else if (PyArg_ParseTuple(args, "i", &id)) {
-			PyErr_Clear(); // ParseTuple(ii) might have left us with args exception, clear.
-			lookup = ReadString(strings, id);
-		}
+		if (!parse_lookup(args, nargs, "expected get(id) or get(count, id)", id, count))
+			return nullptr;
+
+		return nargs == 1 ? lookup(id) : lookup(id, count);
+	}
 
-		if (!lookup)
+#ifndef PY_TWO
+	DEF_FAST_SELF(get_bytes)
+	{
+		uint32_t id = 0;
+		intmax_t count = 0;
+
+		if (!parse_lookup(args, nargs, "expected get_bytes(id) or get_bytes(count, id)", id, count))
+			return nullptr;
+
+		size_t length = 0;
+		auto str = nargs == 1
+			? ReadStringEx(strings, id, &length)
+			: ReadStringPlEx(strings, id, count, &length);
+		if (!str)
 			Py_RETURN_NONE;
 
-		return Py_BuildValue("s", lookup);
+		auto data = static_cast<const char*>(GetStringsData(strings, nullptr));
+		auto const start = (Py_ssize_t)(str - data);
+
+		// a slice of the view of this object keeps the catalog alive for as
+		// long as the slice is
+		auto view = PyMemoryView_FromObject(self);
+		if (!view)
+			return nullptr;
+
+		PyObject* result = nullptr;
+		auto first = PyLong_FromSsize_t(start);
+		auto last = PyLong_FromSsize_t(start + (Py_ssize_t)length);
+		auto slice = first && last ? PySlice_New(first, last, nullptr) : nullptr;
+		if (slice) {
+			result = PyObject_GetItem(view, slice);
+			Py_DECREF(slice);
+		}
+		Py_XDECREF(first);
+		Py_XDECREF(last);
+		Py_DECREF(view);
+		return result;
+	}
+#endif
+
+	DEF_FAST(get_many)
+	{
+		intmax_t count = 0;
+
+		if (nargs < 1 || nargs > 2) {
+			PyErr_SetString(PyExc_TypeError, "expected get_many(ids) or get_many(count, ids)");
+			return nullptr;
+		}
+
+		if (nargs == 2 && !as_count(args[0], count))
+			return nullptr;
+
+		auto ids = PySequence_Fast(args[nargs - 1], "ids must be a sequence");
+		if (!ids)
+			return nullptr;
+
+		auto size = PySequence_Fast_GET_SIZE(ids);
+		auto items = PySequence_Fast_ITEMS(ids);
+		auto result = PyList_New(size);
+		if (!result) {
+			Py_DECREF(ids);
+			return nullptr;
+		}
+
+		for (Py_ssize_t index = 0; index < size; ++index) {
+			uint32_t id = 0;
+			auto item = as_id(items[index], id)
+				? (nargs == 1 ? lookup(id) : lookup(id, count))
+				: nullptr;
+			if (!item) {
+				Py_DECREF(result);
+				Py_DECREF(ids);
+				return nullptr;
+			}
+			PyList_SET_ITEM(result, index, item);
+		}
+
+		Py_DECREF(ids);
+		return result;
 	}
 };
 
@@ -61,8 +277,17 @@ public:
 
 		(void)self;
 
+#ifndef PY_TWO
+		PyObject* source = nullptr;
+		if (!PyArg_ParseTuple(args, "O", &source))
+			return nullptr;
+
+		if (!PyUnicode_Check(source) && PyObject_CheckBuffer(source))
+			return open_buffer(source);
+#endif
+
 		if (!PyArg_ParseTuple(args, "s", &path))
-			Py_RETURN_NONE;
+			return nullptr;
 
 		strings = OpenStrings(path);
 		if (!strings) {
@@ -79,7 +304,39 @@ public:
 		Py_RETURN_NONE;
 	}
 
+#ifndef PY_TWO
+	// opens the catalog in place, keeping the buffer exported for as long as
+	// the langs_file object lives
+	static PyObject* open_buffer(PyObject* source)
+	{
+		Py_buffer view{};
+		if (PyObject_GetBuffer(source, &view, PyBUF_SIMPLE) < 0)
+			return nullptr;
+
+		// the catalog is read as 32-bit words, in place
+		if (reinterpret_cast<uintptr_t>(view.buf) % 4) {
+			PyBuffer_Release(&view);
+			PyErr_SetString(PyExc_ValueError, "buffer must be aligned to 4 bytes");
+			return nullptr;
+		}
+
+		auto strings = OpenStringsFromMemory(view.buf, (size_t)view.len);
+		if (!strings) {
+			PyBuffer_Release(&view);
+			Py_RETURN_NONE;
+		}
+
+		auto pyObj = PyLangFile::Type::create(strings, view);
+		if (pyObj)
+			return pyObj;
+
+		CloseStrings(strings);
+		PyBuffer_Release(&view);
+		Py_RETURN_NONE;
+	}
+#endif
+
 	BEGIN_MOD_MAP(strings)
-		MOD_DEF("open", open, "Opens translation string based on path given.")
+		MOD_DEF("open", open, "Opens translation strings from the path given, or in place, from an object supporting the buffer protocol (bytes, memoryview, mmap), aligned to 4 bytes.")
 	END_MOD_MAP()
 };
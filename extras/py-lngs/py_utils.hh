@@ -11,6 +11,10 @@
 
 #include <string>
 
+#if !defined PY_TWO && PY_VERSION_HEX >= 0x03070000
+#define PY_FASTCALL
+#endif
+
 template <typename Impl>
 struct Type {
 	struct _Impl {
@@ -53,13 +57,15 @@ struct Type {
 		extract(self)->~Impl();
 	}
 
-#ifdef PY_TWO
 	static void dealloc(PyObject *self)
 	{
 		finalize(self);
+#ifdef PY_TWO
 		PyMem_DEL(self);
-	}
+#else
+		PyObject_Del(self);
 #endif
+	}
 
 	static PyObject* build(const std::string& module);
 };
@@ -111,11 +117,8 @@ inline PyObject* Type<Impl>::build(const std::string& module)
 	TypeDef.tp_doc = Impl::py_doc();
 	TypeDef.tp_methods = Impl::py_defs();
 	TypeDef.tp_flags = Py_TPFLAGS_DEFAULT;
-#ifdef PY_TWO
 	TypeDef.tp_dealloc = dealloc;
-#else
-	TypeDef.tp_finalize = finalize;
-#endif
+	Impl::py_slots(TypeDef);
 	if (PyType_Ready(&TypeDef) < 0)
 		return nullptr;
 
@@ -148,6 +151,10 @@ inline bool Module<Impl>::create()
 }
 
 #define BEGIN_TYPE_MAP(name, doc_str) \
+	static void py_slots(PyTypeObject&) {} \
+	BEGIN_TYPE_MAP_WITH_SLOTS(name, doc_str)
+
+#define BEGIN_TYPE_MAP_WITH_SLOTS(name, doc_str) \
 	static const char* py_name() { return name; } \
 	static const char* py_doc() { return doc_str; } \
 	static PyMethodDef* py_defs() \
@@ -155,6 +162,11 @@ inline bool Module<Impl>::create()
 		static PyMethodDef methods[] = {
 
 #define TYPE_DEF(name, call, doc_str) { name, call, METH_VARARGS, doc_str },
+#ifdef PY_FASTCALL
+#define TYPE_DEF_FAST(name, call, doc_str) { name, (PyCFunction)(void(*)(void))call, METH_FASTCALL, doc_str },
+#else
+#define TYPE_DEF_FAST TYPE_DEF
+#endif
 #define END_TYPE_MAP() \
 			{ NULL, NULL, 0, NULL } \
 		}; \
@@ -177,6 +189,45 @@ inline bool Module<Impl>::create()
 	} \
 	PyObject* packed_ ## method(PyObject* args)
 
+// DEF_FAST methods see their positional arguments as an array, either
+// straight from METH_FASTCALL, or unpacked from the METH_VARARGS tuple
+#ifdef PY_FASTCALL
+#define DEF_FAST(method) static PyObject* method(PyObject* self, PyObject* const* args, Py_ssize_t nargs) \
+	{\
+		if (!Type::check(self)) \
+			Py_RETURN_NONE; \
+		return Type::extract(self)->packed_ ## method(args, nargs); \
+	} \
+	PyObject* packed_ ## method(PyObject* const* args, Py_ssize_t nargs)
+#else
+#define DEF_FAST(method) static PyObject* method(PyObject* self, PyObject* args) \
+	{\
+		if (!Type::check(self)) \
+			Py_RETURN_NONE; \
+		return Type::extract(self)->packed_ ## method(&PyTuple_GET_ITEM(args, 0), PyTuple_GET_SIZE(args)); \
+	} \
+	PyObject* packed_ ## method(PyObject* const* args, Py_ssize_t nargs)
+#endif
+
+// DEF_FAST_SELF methods also see the Python object they were called for
+#ifdef PY_FASTCALL
+#define DEF_FAST_SELF(method) static PyObject* method(PyObject* self, PyObject* const* args, Py_ssize_t nargs) \
+	{\
+		if (!Type::check(self)) \
+			Py_RETURN_NONE; \
+		return Type::extract(self)->packed_ ## method(self, args, nargs); \
+	} \
+	PyObject* packed_ ## method(PyObject* self, PyObject* const* args, Py_ssize_t nargs)
+#else
+#define DEF_FAST_SELF(method) static PyObject* method(PyObject* self, PyObject* args) \
+	{\
+		if (!Type::check(self)) \
+			Py_RETURN_NONE; \
+		return Type::extract(self)->packed_ ## method(self, &PyTuple_GET_ITEM(args, 0), PyTuple_GET_SIZE(args)); \
+	} \
+	PyObject* packed_ ## method(PyObject* self, PyObject* const* args, Py_ssize_t nargs)
+#endif
+
 #ifdef PY_TWO
 #define PyMOD(type) \
 	class type; \
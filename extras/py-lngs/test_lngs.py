@@ -0,0 +1,105 @@
+import gc
+import os
+import struct
+import tempfile
+import unittest
+
+import strings
+
+LANG, HDR, ATTR, STRS, LAST = (
+    0x474E414C, 0x72646820, 0x72747461, 0x73727473, 0x7473616C)
+ATTR_PLURALS = 2
+
+
+def section(tag, entries):
+    keys = b''
+    data = b''
+    for id, value in sorted(entries.items()):
+        keys += struct.pack('<3I', id, len(data), len(value))
+        data += value + b'\0'
+    data += b'\0' * (-len(data) % 4)
+    string_offset = 4 + 3 * len(entries)
+    ints = string_offset - 2 + len(data) // 4
+    header = struct.pack('<4I', tag, ints, len(entries), string_offset)
+    return header + keys + data
+
+
+def catalog(second=b'second'):
+    return (struct.pack('<I4I', LANG, HDR, 2, 0x100, 0) +
+            section(ATTR, {ATTR_PLURALS: b'nplurals=2; plural=(n != 1);'}) +
+            section(STRS, {1: b'{0} file\0{0} files', 2: second}) +
+            struct.pack('<2I', LAST, 0))
+
+
+class TestStrings(unittest.TestCase):
+    def test_open_path(self):
+        with tempfile.TemporaryDirectory() as dir:
+            path = os.path.join(dir, 'test.lng')
+            with open(path, 'wb') as output:
+                output.write(catalog())
+            tr = strings.open(path)
+        self.assertEqual(tr(2), 'second')
+        self.assertIsNone(strings.open(path))
+
+    def test_cached_strings(self):
+        tr = strings.open(catalog())
+        self.assertEqual(tr(2), 'second')
+        self.assertIs(tr(2), tr.get(2))
+        self.assertIsNone(tr(3))
+
+        self.assertEqual(tr(1, 1), '{0} file')
+        self.assertEqual(tr(5, 1), '{0} files')
+        # one plural form is decoded once, for any count choosing it
+        self.assertIs(tr(5, 1), tr(7, 1))
+
+    def test_count_goes_first(self):
+        tr = strings.open(catalog())
+        self.assertEqual(tr.get(5, 1), '{0} files')
+        self.assertEqual(tr.get(1, 2), 'second')
+        self.assertEqual(bytes(tr.get_bytes(5, 1)), b'{0} files')
+        self.assertEqual(tr.get_many(5, [1, 2]), ['{0} files', 'second'])
+
+    def test_get_bytes(self):
+        tr = strings.open(catalog())
+        view = tr.get_bytes(2)
+        self.assertIsInstance(view, memoryview)
+        self.assertTrue(view.readonly)
+        self.assertEqual(bytes(view), b'second')
+        self.assertEqual(bytes(tr.get_bytes(5, 1)), b'{0} files')
+        self.assertIsNone(tr.get_bytes(3))
+
+        # the slice keeps the catalog alive
+        del tr
+        gc.collect()
+        self.assertEqual(bytes(view), b'second')
+
+    def test_get_many(self):
+        tr = strings.open(catalog())
+        self.assertEqual(tr.get_many([2, 3, 1]), ['second', None, '{0} file'])
+        self.assertEqual(tr.get_many(5, (1, 2)), ['{0} files', 'second'])
+        self.assertEqual(tr.get_many([]), [])
+        self.assertRaises(TypeError, tr.get_many, 2)
+        self.assertRaises(OverflowError, tr.get_many, [1 << 32])
+
+    def test_buffer_outlives_source(self):
+        data = bytearray(catalog())
+        tr = strings.open(data)
+        self.assertEqual(tr(2), 'second')
+        # exported to the catalog, the buffer cannot be resized
+        self.assertRaises(BufferError, data.extend, b'\0')
+
+        del data
+        gc.collect()
+        self.assertEqual(tr(2), 'second')
+        self.assertEqual(bytes(memoryview(tr)), catalog())
+
+    def test_misaligned_buffer(self):
+        data = bytearray(b'\0' + catalog())
+        self.assertRaises(ValueError, strings.open, memoryview(data)[1:])
+
+    def test_broken_buffer(self):
+        self.assertIsNone(strings.open(b'\0' * 16))
+
+
+if __name__ == '__main__':
+    unittest.main()
@@ -0,0 +1,60 @@
+#include <cstdlib>
+#include <new>
+#include "bench.hpp"
+
+// Every block carries its size in front of the memory handed out, so the
+// number of live bytes can be tracked without relying on sized deletes.
+
+namespace lngs::bench {
+	std::atomic<std::size_t> allocation_count{0};
+	std::atomic<std::size_t> allocation_bytes{0};
+	std::atomic<std::size_t> live_bytes{0};
+	std::atomic<std::size_t> peak_bytes{0};
+
+	namespace {
+		constexpr std::size_t header_size = alignof(std::max_align_t);
+
+		void* allocate(std::size_t size) noexcept {
+			auto block =
+			    static_cast<std::byte*>(std::malloc(size + header_size));
+			if (!block) return nullptr;
+			*reinterpret_cast<std::size_t*>(block) = size;
+
+			allocation_count.fetch_add(1, std::memory_order_relaxed);
+			allocation_bytes.fetch_add(size, std::memory_order_relaxed);
+			auto const live =
+			    live_bytes.fetch_add(size, std::memory_order_relaxed) + size;
+			auto peak = peak_bytes.load(std::memory_order_relaxed);
+			while (peak < live && !peak_bytes.compare_exchange_weak(
+			                          peak, live, std::memory_order_relaxed)) {
+			}
+
+			return block + header_size;
+		}
+
+		void release(void* ptr) noexcept {
+			if (!ptr) return;
+			auto block = static_cast<std::byte*>(ptr) - header_size;
+			live_bytes.fetch_sub(*reinterpret_cast<std::size_t*>(block),
+			                     std::memory_order_relaxed);
+			std::free(block);
+		}
+	}  // namespace
+}  // namespace lngs::bench
+
+void* operator new(std::size_t size) {
+	if (auto ptr = lngs::bench::allocate(size)) return ptr;
+	throw std::bad_alloc{};
+}
+
+void* operator new(std::size_t size, std::nothrow_t const&) noexcept {
+	return lngs::bench::allocate(size);
+}
+
+void operator delete(void* ptr) noexcept { lngs::bench::release(ptr); }
+void operator delete(void* ptr, std::size_t) noexcept {
+	lngs::bench::release(ptr);
+}
+void operator delete(void* ptr, std::nothrow_t const&) noexcept {
+	lngs::bench::release(ptr);
+}
@@ -0,0 +1,66 @@
+#pragma once
+
+#include <benchmark/benchmark.h>
+#include <atomic>
+#include <cstddef>
+#include <lngs/lngs_base.hpp>
+#include <string>
+#include <string_view>
+#include <vector>
+
+namespace lngs::bench {
+	extern std::atomic<std::size_t> allocation_count;
+	extern std::atomic<std::size_t> allocation_bytes;
+	extern std::atomic<std::size_t> live_bytes;
+	extern std::atomic<std::size_t> peak_bytes;
+
+	// Counts allocations made between construction and report(), adding
+	// allocs/op and bytes/op counters to the benchmark. The peak counter
+	// is the highest number of bytes held at once above the level from
+	// the construction time.
+	struct allocations {
+		std::size_t count{allocation_count.load()};
+		std::size_t bytes{allocation_bytes.load()};
+		std::size_t live{live_bytes.load()};
+
+		allocations() { peak_bytes.store(live); }
+
+		void report(benchmark::State& state) const {
+			using benchmark::Counter;
+			state.counters["allocs/op"] =
+			    Counter(static_cast<double>(allocation_count.load() - count),
+			            Counter::kAvgIterations);
+			state.counters["bytes/op"] =
+			    Counter(static_cast<double>(allocation_bytes.load() - bytes),
+			            Counter::kAvgIterations);
+			state.counters["peak"] =
+			    Counter(static_cast<double>(peak_bytes.load() - live),
+			            Counter::kDefaults, Counter::kIs1024);
+		}
+	};
+
+	struct catalog_info {
+		std::size_t strings{100};
+		// every n-th string has plural forms
+		std::size_t plural_every{4};
+		bool with_keys{true};
+		std::string plurals{"nplurals=2; plural=(n != 1);"};
+		std::string culture{"en-US"};
+	};
+
+	static constexpr uint32_t first_id = 1000;
+
+	std::vector<std::byte> make_catalog(catalog_info const& info);
+	std::string key_name(std::size_t index);
+
+	struct plural_rule {
+		const char* language;
+		const char* rule;
+	};
+
+	extern std::vector<plural_rule> const plural_rules;
+
+	// Pseudo-random, but repeatable, indexes in [0, size).
+	std::vector<std::size_t> shuffled_indexes(std::size_t size,
+	                                          std::size_t count = 4096);
+}  // namespace lngs::bench
@@ -0,0 +1,120 @@
+#include "bench.hpp"
+
+namespace lngs::bench {
+	namespace {
+		void append_le(std::vector<std::byte>& out, uint32_t value) {
+			for (int shift = 0; shift < 32; shift += 8)
+				out.push_back(static_cast<std::byte>((value >> shift) & 0xFF));
+		}
+
+		void section(
+		    std::vector<std::byte>& out,
+		    uint32_t tag,
+		    std::vector<std::pair<uint32_t, std::string>> const& items) {
+			if (items.empty()) return;
+
+			std::vector<std::byte> keys;
+			std::vector<std::byte> data;
+			for (auto const& [id, value] : items) {
+				append_le(keys, id);
+				append_le(keys, static_cast<uint32_t>(data.size()));
+				append_le(keys, static_cast<uint32_t>(value.size()));
+				for (auto c : value)
+					data.push_back(static_cast<std::byte>(c));
+				data.push_back(std::byte{});
+			}
+			while (data.size() % sizeof(uint32_t))
+				data.push_back(std::byte{});
+
+			auto const words = [](std::size_t bytes) {
+				return static_cast<uint32_t>(bytes / sizeof(uint32_t));
+			};
+			auto const offset = words(sizeof(string_header) + keys.size());
+
+			append_le(out, tag);
+			append_le(out, offset - words(sizeof(section_header)) +
+			                   words(data.size()));
+			append_le(out, static_cast<uint32_t>(items.size()));
+			append_le(out, offset);
+			out.insert(out.end(), keys.begin(), keys.end());
+			out.insert(out.end(), data.begin(), data.end());
+		}
+	}  // namespace
+
+	std::string key_name(std::size_t index) {
+		return "GENERATED_STRING_KEY_" + std::to_string(index);
+	}
+
+	std::vector<std::byte> make_catalog(catalog_info const& info) {
+		std::vector<std::pair<uint32_t, std::string>> attrs{
+		    {ATTR_CULTURE, info.culture},
+		    {ATTR_PLURALS, info.plurals},
+		};
+		std::vector<std::pair<uint32_t, std::string>> strings;
+		std::vector<std::pair<uint32_t, std::string>> keys;
+		strings.reserve(info.strings);
+		if (info.with_keys) keys.reserve(info.strings);
+
+		for (std::size_t index = 0; index < info.strings; ++index) {
+			auto const id = first_id + static_cast<uint32_t>(index);
+			auto const num = std::to_string(index);
+			if (info.plural_every && !(index % info.plural_every)) {
+				std::string value = "{0} item of kind " + num;
+				value.push_back(0);
+				value.append("{0} items of kind " + num);
+				strings.emplace_back(id, std::move(value));
+			} else {
+				strings.emplace_back(id, "Translated string number " + num);
+			}
+			if (info.with_keys) keys.emplace_back(id, key_name(index));
+		}
+
+		std::vector<std::byte> out;
+		append_le(out, langtext_tag);
+		append_le(out, hdrtext_tag);
+		append_le(out, 2);
+		append_le(out, v1_0::version);
+		append_le(out, 0);
+		section(out, attrtext_tag, attrs);
+		section(out, strstext_tag, strings);
+		section(out, keystext_tag, keys);
+		append_le(out, lasttext_tag);
+		append_le(out, 0);
+		return out;
+	}
+
+	std::vector<plural_rule> const plural_rules{
+	    {"ja", "nplurals=1; plural=0;"},
+	    {"en", "nplurals=2; plural=(n != 1);"},
+	    {"fr", "nplurals=2; plural=(n > 1);"},
+	    {"cs", "nplurals=3; plural=(n==1) ? 0 : (n>=2 && n<=4) ? 1 : 2;"},
+	    {"lv",
+	     "nplurals=3; plural=(n%10==1 && n%100!=11 ? 0 : n != 0 ? 1 : 2);"},
+	    {"pl",
+	     "nplurals=3; plural=(n==1 ? 0 : n%10>=2 && n%10<=4 && (n%100<10 || "
+	     "n%100>=20) ? 1 : 2);"},
+	    {"ru",
+	     "nplurals=3; plural=(n%10==1 && n%100!=11 ? 0 : n%10>=2 && n%10<=4 "
+	     "&& (n%100<10 || n%100>=20) ? 1 : 2);"},
+	    {"sl",
+	     "nplurals=4; plural=(n%100==1 ? 0 : n%100==2 ? 1 : n%100==3 || "
+	     "n%100==4 ? 2 : 3);"},
+	    {"ar",
+	     "nplurals=6; plural=(n==0 ? 0 : n==1 ? 1 : n==2 ? 2 : n%100>=3 && "
+	     "n%100<=10 ? 3 : n%100>=11 ? 4 : 5);"},
+	};
+
+	std::vector<std::size_t> shuffled_indexes(std::size_t size,
+	                                          std::size_t count) {
+		std::vector<std::size_t> out;
+		out.reserve(count);
+		uint64_t state = 0x9E3779B97F4A7C15ull;
+		for (std::size_t index = 0; index < count; ++index) {
+			state ^= state << 13;
+			state ^= state >> 7;
+			state ^= state << 17;
+			out.push_back(static_cast<std::size_t>(state % size));
+		}
+		return out;
+	}
+}  // namespace lngs::bench
@@ -0,0 +1,129 @@
+#include <lngs/lngs_file.hpp>
+#include "bench.hpp"
+
+namespace lngs::bench {
+	namespace {
+		catalog_info sized(std::size_t strings) {
+			catalog_info info{};
+			info.strings = strings;
+			return info;
+		}
+
+		struct opened {
+			std::vector<std::byte> bytes;
+			lang_file file;
+
+			explicit opened(std::size_t strings)
+			    : bytes{make_catalog(sized(strings))} {
+				file.open({bytes.data(), bytes.size()});
+			}
+		};
+
+		lang_file::identifier ident(std::size_t index) {
+			return static_cast<lang_file::identifier>(
+			    first_id + static_cast<uint32_t>(index));
+		}
+	}  // namespace
+
+	void lang_file_open(benchmark::State& state) {
+		auto const bytes =
+		    make_catalog(sized(static_cast<std::size_t>(state.range(0))));
+		allocations allocs{};
+		for (auto _ : state) {
+			lang_file file;
+			benchmark::DoNotOptimize(file.open({bytes.data(), bytes.size()}));
+		}
+		allocs.report(state);
+		state.SetBytesProcessed(static_cast<int64_t>(state.iterations()) *
+		                        static_cast<int64_t>(bytes.size()));
+	}
+	BENCHMARK(lang_file_open)->Arg(10)->Arg(100'000);
+
+	void get_string_sequential(benchmark::State& state) {
+		auto const strings = static_cast<std::size_t>(state.range(0));
+		opened data{strings};
+		std::size_t index = 0;
+		allocations allocs{};
+		for (auto _ : state) {
+			benchmark::DoNotOptimize(data.file.get_string(ident(index)));
+			if (++index == strings) index = 0;
+		}
+		allocs.report(state);
+	}
+	BENCHMARK(get_string_sequential)->Arg(100)->Arg(10'000);
+
+	void get_string_random(benchmark::State& state) {
+		auto const strings = static_cast<std::size_t>(state.range(0));
+		opened data{strings};
+		auto const indexes = shuffled_indexes(strings);
+		std::size_t index = 0;
+		allocations allocs{};
+		for (auto _ : state) {
+			benchmark::DoNotOptimize(
+			    data.file.get_string(ident(indexes[index])));
+			if (++index == indexes.size()) index = 0;
+		}
+		allocs.report(state);
+	}
+	BENCHMARK(get_string_random)->Arg(100)->Arg(10'000);
+
+	void get_string_plural(benchmark::State& state) {
+		auto const strings = static_cast<std::size_t>(state.range(0));
+		opened data{strings};
+		auto const indexes = shuffled_indexes(strings);
+		std::size_t index = 0;
+		intmax_t count = 0;
+		allocations allocs{};
+		for (auto _ : state) {
+			// every fourth string has plural forms
+			auto const id = ident(indexes[index] & ~std::size_t{3});
+			benchmark::DoNotOptimize(data.file.get_string(
+			    id, static_cast<lang_file::quantity>(count++)));
+			if (++index == indexes.size()) index = 0;
+		}
+		allocs.report(state);
+	}
+	BENCHMARK(get_string_plural)->Arg(100)->Arg(10'000);
+
+	void get_attr(benchmark::State& state) {
+		opened data{100};
+		allocations allocs{};
+		for (auto _ : state) {
+			benchmark::DoNotOptimize(data.file.get_attr(ATTR_CULTURE));
+			benchmark::DoNotOptimize(data.file.get_attr(ATTR_PLURALS));
+		}
+		allocs.report(state);
+	}
+	BENCHMARK(get_attr);
+
+	void get_key(benchmark::State& state) {
+		auto const strings = static_cast<std::size_t>(state.range(0));
+		opened data{strings};
+		auto const indexes = shuffled_indexes(strings);
+		std::size_t index = 0;
+		allocations allocs{};
+		for (auto _ : state) {
+			benchmark::DoNotOptimize(data.file.get_key(
+			    first_id + static_cast<uint32_t>(indexes[index])));
+			if (++index == indexes.size()) index = 0;
+		}
+		allocs.report(state);
+	}
+	BENCHMARK(get_key)->Arg(100)->Arg(10'000);
+
+	void find_key(benchmark::State& state) {
+		auto const strings = static_cast<std::size_t>(state.range(0));
+		opened data{strings};
+		std::vector<std::string> keys;
+		for (auto index : shuffled_indexes(strings, 256))
+			keys.push_back(key_name(index));
+		std::size_t index = 0;
+		allocations allocs{};
+		for (auto _ : state) {
+			benchmark::DoNotOptimize(data.file.find_key(keys[index]));
+			if (++index == keys.size()) index = 0;
+		}
+		allocs.report(state);
+	}
+	BENCHMARK(find_key)->Arg(100)->Arg(10'000);
+}  // namespace lngs::bench
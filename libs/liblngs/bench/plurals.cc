@@ -0,0 +1,31 @@
+#include <lngs/plurals.hpp>
+#include "bench.hpp"
+
+namespace lngs::bench {
+	void plurals_decode(benchmark::State& state) {
+		auto const& rule =
+		    plural_rules[static_cast<std::size_t>(state.range(0))];
+		state.SetLabel(rule.language);
+		allocations allocs{};
+		for (auto _ : state) {
+			benchmark::DoNotOptimize(plurals::decode(rule.rule));
+		}
+		allocs.report(state);
+	}
+	BENCHMARK(plurals_decode)->DenseRange(0, 8);
+
+	void plurals_eval(benchmark::State& state) {
+		auto const& rule =
+		    plural_rules[static_cast<std::size_t>(state.range(0))];
+		state.SetLabel(rule.language);
+		auto const lex = plurals::decode(rule.rule);
+		intmax_t count = 0;
+		allocations allocs{};
+		for (auto _ : state) {
+			benchmark::DoNotOptimize(lex.eval(count));
+			count = (count + 1) & 0x3FF;
+		}
+		allocs.report(state);
+	}
+	BENCHMARK(plurals_eval)->DenseRange(0, 8);
+}  // namespace lngs::bench
@@ -0,0 +1,57 @@
+#include <filesystem>
+#include <fstream>
+#include <lngs/lngs_storage.hpp>
+#include "bench.hpp"
+
+namespace lngs::bench {
+	void http_accept_language(benchmark::State& state) {
+		static constexpr auto header =
+		    "pl-PL,pl;q=0.9,en-US;q=0.8,en;q=0.7,de-DE;q=0.6,de;q=0.5,"
+		    "fr-FR;q=0.4,*;q=0.1";
+		allocations allocs{};
+		for (auto _ : state) {
+			benchmark::DoNotOptimize(lngs::http_accept_language(header));
+		}
+		allocs.report(state);
+	}
+	BENCHMARK(http_accept_language);
+
+	void system_locales(benchmark::State& state) {
+		allocations allocs{};
+		for (auto _ : state) {
+			benchmark::DoNotOptimize(lngs::system_locales(false));
+		}
+		allocs.report(state);
+	}
+	BENCHMARK(system_locales);
+
+	void translation_open(benchmark::State& state) {
+		auto const dir = std::filesystem::temp_directory_path() /
+		                 ("liblngs_bench_" + std::to_string(state.range(0)));
+		std::filesystem::create_directories(dir);
+
+		catalog_info info{};
+		info.strings = static_cast<std::size_t>(state.range(0));
+		auto const bytes = make_catalog(info);
+		{
+			std::ofstream out{dir / "bench.en", std::ios::binary};
+			out.write(reinterpret_cast<char const*>(bytes.data()),
+			          static_cast<std::streamsize>(bytes.size()));
+		}
+
+		translation tr;
+		tr.path_manager<manager::ExtensionPath>(dir, "bench");
+
+		allocations allocs{};
+		for (auto _ : state) {
+			benchmark::DoNotOptimize(tr.open("en", SerialNumber::UseAny));
+		}
+		allocs.report(state);
+		state.SetBytesProcessed(static_cast<int64_t>(state.iterations()) *
+		                        static_cast<int64_t>(bytes.size()));
+
+		std::error_code ec;
+		std::filesystem::remove_all(dir, ec);
+	}
+	BENCHMARK(translation_open)->Arg(10)->Arg(100'000);
+}  // namespace lngs::bench
@@ -3,9 +3,89 @@
 
 #pragma once
 
+#include <iterator>
 #include <lngs/lngs_storage.hpp>
+#include <utility>
+
+#if defined(__cpp_nontype_template_args) && \
+    __cpp_nontype_template_args >= 201911L
+#define LNGS_HAS_KEY_LITERALS 1
+#endif
 
 namespace lngs {
+	// Slot of an id, which is not in the definition file.
+	constexpr uint32_t no_slot = ~uint32_t{};
+
+	// Used by the headers from "lngs enums --dense" to turn an id into its
+	// slot, with a table of slots for all the ids starting from the first.
+	template <typename Enum, std::size_t Size>
+	constexpr lang_file::slot slot_in(uint32_t const (&slots)[Size],
+	                                  uint32_t first,
+	                                  Enum val) noexcept {
+		auto const index = static_cast<uint32_t>(val) - first;
+		return lang_file::slot{index < Size ? slots[index] : no_slot};
+	}
+
+	template <typename Enum>
+	struct key_tag {};
+
+	template <typename Enum>
+	using key_entry = std::pair<std::string_view, Enum>;
+
+	namespace detail {
+		// Not constexpr on purpose: id_of() only calls it for unknown keys,
+		// so that a constant expression with such a key does not compile.
+		inline uint32_t unknown_key() noexcept { return no_slot; }
+	}  // namespace detail
+
+	// Id of a string by its key, from the map in a header made with
+	// "lngs enums --keys". An unknown key fails the build in a constant
+	// expression and gives an id without a string at runtime.
+	template <typename Enum>
+	constexpr Enum id_of(std::string_view key) noexcept {
+		auto const& map = keys_of(key_tag<Enum>{});
+		std::size_t first = 0;
+		std::size_t last = std::size(map);
+		while (first < last) {
+			auto const middle = first + (last - first) / 2;
+			if (map[middle].first < key)
+				first = middle + 1;
+			else
+				last = middle;
+		}
+		if (first < std::size(map) && map[first].first == key)
+			return map[first].second;
+		return static_cast<Enum>(detail::unknown_key());
+	}
+
+#ifdef LNGS_HAS_KEY_LITERALS
+	// Key of a string as a template argument, for tr.get<"KEY">().
+	template <std::size_t Size>
+	struct key_literal {
+		char chars[Size]{};
+
+		constexpr key_literal(char const (&key)[Size]) noexcept {
+			for (std::size_t index = 0; index < Size; ++index)
+				chars[index] = key[index];
+		}
+
+		constexpr std::string_view view() const noexcept {
+			return {chars, Size - 1};
+		}
+	};
+#endif
+
+	namespace detail {
+		// True, if the header for the Enum was made with --dense and has
+		// a slot_of(Enum).
+		template <typename Enum, typename = void>
+		struct has_slots : std::false_type {};
+		template <typename Enum>
+		struct has_slots<Enum,
+		                 std::void_t<decltype(slot_of(std::declval<Enum>()))>>
+		    : std::true_type {};
+	}  // namespace detail
+
 	template <unsigned Serial, typename Storage>
 	class VersionedBuiltin : public Storage {
 	public:
@@ -61,7 +141,29 @@ namespace lngs {
 
 		std::string_view operator()(Enum val) const noexcept {
 			auto const id = static_cast<lang_file::identifier>(val);
-			return Storage::get_string(id);
+			if constexpr (detail::has_slots<Enum>::value)
+				return Storage::get_string(id, slot_of(val));
+			else
+				return Storage::get_string(id);
+		}
+
+#ifdef LNGS_HAS_KEY_LITERALS
+		// The key is resolved at compile time; an unknown one fails the
+		// build.
+		template <key_literal Key>
+		std::string_view get() const noexcept {
+			constexpr auto val = id_of<Enum>(Key.view());
+			return (*this)(val);
+		}
+#endif
+
+		std::size_t format(Enum val,
+		                   std::initializer_list<std::string_view> args,
+		                   char* buffer,
+		                   std::size_t size) const noexcept {
+			auto const id = static_cast<lang_file::identifier>(val);
+			return Storage::format(id, args.begin(), args.size(), buffer,
+			                       size);
 		}
 
 		std::string attr(v1_0::attr_t val) const noexcept {
@@ -81,7 +183,47 @@ namespace lngs {
 		std::string_view operator()(Enum val, intmax_t count) const noexcept {
 			auto const id = static_cast<lang_file::identifier>(val);
 			auto const quantity = static_cast<lang_file::quantity>(count);
-			return Storage::get_string(id, quantity);
+			if constexpr (detail::has_slots<Enum>::value)
+				return Storage::get_string(id, slot_of(val), quantity);
+			else
+				return Storage::get_string(id, quantity);
+		}
+
+		// Forms of the string for each of the counts, e.g. for a column of
+		// a report; false, if there is no such string.
+		bool operator()(Enum val,
+		                intmax_t const* counts,
+		                std::string_view* out,
+		                std::size_t size) const noexcept {
+			return Storage::get_strings(static_cast<lang_file::identifier>(val),
+			                            counts, out, size);
+		}
+
+		// Index of the plural form chosen for the count; all the counts with
+		// the same index get the same form of the string.
+		intmax_t plural_index(Enum val, intmax_t count) const noexcept {
+			return Storage::plural_index(
+			    static_cast<lang_file::identifier>(val),
+			    static_cast<lang_file::quantity>(count));
+		}
+
+#ifdef LNGS_HAS_KEY_LITERALS
+		template <key_literal Key>
+		std::string_view get(intmax_t count) const noexcept {
+			constexpr auto val = id_of<Enum>(Key.view());
+			return (*this)(val, count);
+		}
+#endif
+
+		std::size_t format(Enum val,
+		                   intmax_t count,
+		                   std::initializer_list<std::string_view> args,
+		                   char* buffer,
+		                   std::size_t size) const noexcept {
+			auto const id = static_cast<lang_file::identifier>(val);
+			auto const quantity = static_cast<lang_file::quantity>(count);
+			return Storage::format(id, quantity, args.begin(), args.size(),
+			                       buffer, size);
 		}
 
 		std::string attr(v1_0::attr_t val) const noexcept {
@@ -105,7 +247,47 @@ namespace lngs {
 		std::string_view operator()(PEnum val, intmax_t count) const noexcept {
 			auto const id = static_cast<lang_file::identifier>(val);
 			auto const quantity = static_cast<lang_file::quantity>(count);
-			return SingularStrings<SEnum, Storage>::get_string(id, quantity);
+			if constexpr (detail::has_slots<PEnum>::value)
+				return SingularStrings<SEnum, Storage>::get_string(
+				    id, slot_of(val), quantity);
+			else
+				return SingularStrings<SEnum, Storage>::get_string(id,
+				                                                   quantity);
+		}
+
+		bool operator()(PEnum val,
+		                intmax_t const* counts,
+		                std::string_view* out,
+		                std::size_t size) const noexcept {
+			return SingularStrings<SEnum, Storage>::get_strings(
+			    static_cast<lang_file::identifier>(val), counts, out, size);
+		}
+
+		intmax_t plural_index(PEnum val, intmax_t count) const noexcept {
+			return Storage::plural_index(
+			    static_cast<lang_file::identifier>(val),
+			    static_cast<lang_file::quantity>(count));
+		}
+
+#ifdef LNGS_HAS_KEY_LITERALS
+		using SingularStrings<SEnum, Storage>::get;  // un-hide
+		template <key_literal Key>
+		std::string_view get(intmax_t count) const noexcept {
+			constexpr auto val = id_of<PEnum>(Key.view());
+			return (*this)(val, count);
+		}
+#endif
+
+		using SingularStrings<SEnum, Storage>::format;  // un-hide
+		std::size_t format(PEnum val,
+		                   intmax_t count,
+		                   std::initializer_list<std::string_view> args,
+		                   char* buffer,
+		                   std::size_t size) const noexcept {
+			auto const id = static_cast<lang_file::identifier>(val);
+			auto const quantity = static_cast<lang_file::quantity>(count);
+			return Storage::format(id, quantity, args.begin(), args.size(),
+			                       buffer, size);
 		}
 	};
 }  // namespace lngs
@@ -44,6 +44,37 @@ namespace lngs {
 	//  [5]     [3]*4    ?*4   String data. Each string takes as much as [4][2]
 	//                         bytes, terminated by a zero byte. The data is
 	//                         word-aligned.
+	//
+	//  Optional 'fmts' section:
+	//  [2]         8      4   Templates count
+	//  [3]        12      4   Offset to the begining of the segments, in
+	//                         words, counting from the begining of the section
+	//  [4]        16 [2]*12   Template keys
+	//              0      4    - @id of the 'strs' string this template was
+	//                            compiled from
+	//              4      4    - index of the first segment of the template
+	//              8      4    - number of segments in the template
+	//  [5]     [3]*4  ?*8     Segments. Each segment is either a literal,
+	//                         taken from the 'strs' string, a placeholder for
+	//                         an argument or a boundary between plural forms
+	//              0      4    - for literals, offset of the text, counted
+	//                            from the beginning of the string, in bytes;
+	//                            for placeholders, index of the argument
+	//              4      4    - for literals, length of the text, in bytes;
+	//                            otherwise, one of segment_kind values
+	//
+	//  A file with the 'fmts' section has templates only for strings, which
+	//  have at least one placeholder or an escaped brace, any other string
+	//  can be copied verbatim. A plural form, which is not a valid template,
+	//  is a single literal of the whole form.
+	//
+	//  Optional 'dens' section:
+	//  [2]         8      4   Number of strings in the definition file. The
+	//                         'strs' section of such a file has exactly one
+	//                         key for each of them, sorted by @id, with an
+	//                         empty string for a missing translation, so the
+	//                         position of a string is known at compile time
+	//                         (see "lngs enums --dense").
 
 	struct section_header {
 		uint32_t id;
@@ -61,6 +92,8 @@ namespace lngs {
 			attrtext_tag = 0x72747461u,
 			strstext_tag = 0x73727473u,
 			keystext_tag = 0x7379656Bu,
+			fmtstext_tag = 0x73746D66u,
+			denstext_tag = 0x736E6564u,
 			lasttext_tag = 0x7473616Cu
 		};
 
@@ -79,5 +112,15 @@ namespace lngs {
 			uint32_t offset = 0;
 			uint32_t length = 0;
 		};
+
+		enum segment_kind : uint32_t {
+			segment_plural_break = 0xFFFFFFFEu,
+			segment_placeholder = 0xFFFFFFFFu,
+		};
+
+		struct format_segment {
+			uint32_t value = 0;
+			uint32_t length = 0;
+		};
 	}  // namespace v1_0
 }  // namespace lngs
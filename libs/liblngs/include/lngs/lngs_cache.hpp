@@ -0,0 +1,236 @@
+// Copyright (c) 2026 midnightBITS
+// This code is licensed under MIT license (see LICENSE for details)
+
+#pragma once
+
+#include <atomic>
+#include <functional>
+#include <iterator>
+#include <list>
+#include <lngs/lngs.hpp>
+#include <memory>
+#include <mutex>
+#include <string>
+#include <string_view>
+#include <type_traits>
+#include <unordered_map>
+#include <vector>
+
+namespace lngs {
+	namespace cache {
+		template <typename Strings, typename = void>
+		struct has_onupdate : std::false_type {};
+		template <typename Strings>
+		struct has_onupdate<
+		    Strings,
+		    std::void_t<decltype(std::declval<Strings&>().add_onupdate(
+		        std::declval<std::function<void()>>()))>> : std::true_type {};
+
+		template <typename Strings>
+		constexpr bool has_onupdate_v = has_onupdate<Strings>::value;
+
+		struct key_hash {
+			uint64_t value{14695981039346656037ull};
+
+			void add(void const* data, std::size_t length) noexcept {
+				auto bytes = static_cast<unsigned char const*>(data);
+				for (std::size_t index = 0; index < length; ++index) {
+					value ^= bytes[index];
+					value *= 1099511628211ull;
+				}
+			}
+
+			template <typename T>
+			void add(T const& val) noexcept {
+				add(&val, sizeof(val));
+			}
+		};
+	}  // namespace cache
+
+	// Memoizes formatted strings of a Strings object. An entry is keyed by the
+	// string id, the plural form chosen for the count and the arguments. All
+	// entries are dropped when the Strings object opens another file; Strings
+	// without add_onupdate() are builtin-only and never change once
+	// initialized. Create the cache after setting up the path manager.
+	template <typename Strings,
+	          std::size_t ShardCount = 16,
+	          std::size_t ShardCapacity = 64>
+	class FormatCache {
+		static_assert(ShardCount > 0 && ShardCapacity > 0);
+
+	public:
+		static constexpr std::size_t capacity = ShardCount * ShardCapacity;
+
+		explicit FormatCache(Strings& strings) : m_strings{strings} {
+			if constexpr (cache::has_onupdate_v<Strings>) {
+				m_token = m_strings.add_onupdate([generation = m_generation] {
+					generation->fetch_add(1, std::memory_order_acq_rel);
+				});
+			}
+		}
+
+		~FormatCache() {
+			if constexpr (cache::has_onupdate_v<Strings>)
+				m_strings.remove_onupdate(m_token);
+		}
+
+		FormatCache(FormatCache const&) = delete;
+		FormatCache& operator=(FormatCache const&) = delete;
+
+		template <typename Enum>
+		std::string format(Enum val,
+		                   std::initializer_list<std::string_view> args) {
+			auto const generation =
+			    m_generation->load(std::memory_order_acquire);
+			return lookup(generation, static_cast<uint32_t>(val), 0, args,
+			              [&](char* buffer, std::size_t size) {
+				              return m_strings.format(val, args, buffer, size);
+			              });
+		}
+
+		template <typename Enum>
+		std::string format(Enum val,
+		                   intmax_t count,
+		                   std::initializer_list<std::string_view> args) {
+			// the plural rule belongs to the file of this generation
+			auto const generation =
+			    m_generation->load(std::memory_order_acquire);
+			auto const form = m_strings.plural_index(val, count);
+			return lookup(generation, static_cast<uint32_t>(val), form, args,
+			              [&](char* buffer, std::size_t size) {
+				              return m_strings.format(val, count, args, buffer,
+				                                      size);
+			              });
+		}
+
+		void clear() {
+			for (auto& shard : m_shards) {
+				std::lock_guard<std::mutex> guard{shard.lock};
+				shard.clear();
+			}
+		}
+
+		std::size_t size() const {
+			auto const generation =
+			    m_generation->load(std::memory_order_acquire);
+			std::size_t result = 0;
+			for (auto& shard : m_shards) {
+				std::lock_guard<std::mutex> guard{shard.lock};
+				if (shard.generation == generation) result += shard.lru.size();
+			}
+			return result;
+		}
+
+	private:
+		struct entry {
+			uint64_t hash;
+			uint32_t id;
+			intmax_t form;
+			std::vector<std::string> args;
+			std::string value;
+
+			bool matches(uint32_t other_id,
+			             intmax_t other_form,
+			             std::initializer_list<std::string_view> other_args)
+			    const noexcept {
+				if (id != other_id || form != other_form ||
+				    args.size() != other_args.size())
+					return false;
+
+				auto it = args.begin();
+				for (auto const& arg : other_args) {
+					if (*it++ != arg) return false;
+				}
+				return true;
+			}
+		};
+
+		using entries = std::list<entry>;
+
+		struct shard {
+			mutable std::mutex lock{};
+			uint64_t generation{0};
+			entries lru{};
+			std::unordered_multimap<uint64_t, typename entries::iterator>
+			    index{};
+
+			void clear() {
+				index.clear();
+				lru.clear();
+			}
+		};
+
+		template <typename Formatter>
+		static std::string format_value(Formatter& formatter) {
+			std::string value;
+			char buffer[256];
+			auto length = formatter(buffer, sizeof(buffer));
+			if (length <= sizeof(buffer)) {
+				value.assign(buffer, length);
+			} else {
+				value.resize(length);
+				formatter(value.data(), value.size());
+			}
+			return value;
+		}
+
+		template <typename Formatter>
+		std::string lookup(uint64_t generation,
+		                   uint32_t id,
+		                   intmax_t form,
+		                   std::initializer_list<std::string_view> args,
+		                   Formatter&& formatter) {
+			cache::key_hash hash{};
+			hash.add(id);
+			hash.add(form);
+			for (auto const& arg : args) {
+				hash.add(arg.size());
+				hash.add(arg.data(), arg.size());
+			}
+
+			auto& shard = m_shards[hash.value % ShardCount];
+			std::lock_guard<std::mutex> guard{shard.lock};
+
+			// another thread has seen a newer file; the form found for this
+			// one might be stale, so it is not remembered
+			if (shard.generation > generation) return format_value(formatter);
+
+			if (shard.generation != generation) {
+				shard.clear();
+				shard.generation = generation;
+			}
+
+			auto [it, end] = shard.index.equal_range(hash.value);
+			for (; it != end; ++it) {
+				auto const pos = it->second;
+				if (!pos->matches(id, form, args)) continue;
+				shard.lru.splice(shard.lru.begin(), shard.lru, pos);
+				return pos->value;
+			}
+
+			if (shard.lru.size() >= ShardCapacity) {
+				auto const last = std::prev(shard.lru.end());
+				auto [victim, victim_end] = shard.index.equal_range(last->hash);
+				for (; victim != victim_end; ++victim) {
+					if (victim->second == last) {
+						shard.index.erase(victim);
+						break;
+					}
+				}
+				shard.lru.pop_back();
+			}
+
+			shard.lru.push_front({hash.value, id, form,
+			                      {args.begin(), args.end()},
+			                      format_value(formatter)});
+			shard.index.emplace(hash.value, shard.lru.begin());
+			return shard.lru.front().value;
+		}
+
+		Strings& m_strings;
+		std::shared_ptr<std::atomic<uint64_t>> m_generation{
+		    std::make_shared<std::atomic<uint64_t>>(0)};
+		uint32_t m_token{0};
+		shard m_shards[ShardCount];
+	};
+}  // namespace lngs
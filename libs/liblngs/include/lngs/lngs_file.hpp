@@ -8,6 +8,7 @@
 #include <lngs/plurals.hpp>
 #include <memory>
 #include <string_view>
+#include <vector>
 
 namespace lngs {
 
@@ -16,9 +17,44 @@ namespace lngs {
 		uintmax_t size = 0;
 	};
 
+	// What a loaded catalog costs. Bytes of the file are either mapped, for
+	// files mapped into memory and resources compiled into the binary, or on
+	// the heap, for files read into a buffer; the heap also has everything
+	// built on top of the file, like the plural expression, which is shared
+	// by all catalogs with the same rule. The sections are parts of the
+	// file, already counted in one of the two.
+	struct memory_footprint {
+		struct section_sizes {
+			uintmax_t attrs{};
+			uintmax_t strings{};
+			uintmax_t keys{};
+			uintmax_t formats{};
+		};
+
+		uintmax_t mapped{};
+		uintmax_t heap{};
+		section_sizes sections{};
+
+		uintmax_t total() const noexcept { return mapped + heap; }
+
+		memory_footprint& operator+=(memory_footprint const& rhs) noexcept {
+			mapped += rhs.mapped;
+			heap += rhs.heap;
+			sections.attrs += rhs.sections.attrs;
+			sections.strings += rhs.sections.strings;
+			sections.keys += rhs.sections.keys;
+			sections.formats += rhs.sections.formats;
+			return *this;
+		}
+	};
+
 	struct lang_file {
 		enum class identifier : uint32_t {};
 		enum class quantity : intmax_t {};
+		// Position of a string in a file with the 'dens' section, as given
+		// by "lngs enums --dense". Only a hint: a string, which is not at
+		// that position, is still found by its id.
+		enum class slot : uint32_t {};
 		lang_file() noexcept;
 		~lang_file() noexcept { close(); }
 		bool open(const memory_view& view) noexcept;
@@ -27,24 +63,72 @@ namespace lngs {
 		std::string_view get_string(identifier id) const noexcept;
 		std::string_view get_string(identifier id,
 		                            quantity count) const noexcept;
+		std::string_view get_string(identifier id, slot pos) const noexcept;
+		std::string_view get_string(identifier id,
+		                            slot pos,
+		                            quantity count) const noexcept;
 		std::string_view get_attr(uint32_t id) const noexcept;
 		std::string_view get_key(uint32_t id) const noexcept;
 		uint32_t find_key(std::string_view id) const noexcept;
 		uint32_t size() const noexcept { return strings.count; }
+		// Number of strings in the definition file, if the file has the
+		// 'dens' section, zero otherwise.
+		uint32_t dense_size() const noexcept { return dense; }
 		intmax_t calc_substring(quantity count) const;
+		// Plural forms for many counts at once, with the same results as
+		// plurals::lexical::eval_many().
+		void calc_substrings(intmax_t const* counts,
+		                     uint8_t* forms,
+		                     std::size_t size) const;
+		// The same as get_string(id, quantity{counts[index]}) for each of
+		// the counts, e.g. for a column of a report; the string is found and
+		// split into its forms once. Returns false, with empty views in out,
+		// if there is no such string.
+		bool get_strings(identifier id,
+		                 intmax_t const* counts,
+		                 std::string_view* out,
+		                 std::size_t size) const noexcept;
+		// Only the sections and the plural expression; the caller knows,
+		// where the memory_view came from.
+		memory_footprint memory_usage() const noexcept;
+
+		// Picks the sub-th form of NUL-separated plural forms, or the first
+		// one, if there are not enough forms.
+		static std::string_view plural_form(std::string_view str,
+		                                    intmax_t sub) noexcept;
+
+		// Renders the string into the buffer, replacing {N} placeholders
+		// with args[N]; returns the length of the whole result, which may be
+		// larger than size, in which case the output was truncated. Uses the
+		// 'fmts' section, if the file has one, otherwise parses the string.
+		std::size_t format(identifier id,
+		                   std::string_view const* args,
+		                   std::size_t arg_count,
+		                   char* buffer,
+		                   std::size_t size) const noexcept;
+		std::size_t format(identifier id,
+		                   quantity count,
+		                   std::string_view const* args,
+		                   std::size_t arg_count,
+		                   char* buffer,
+		                   std::size_t size) const noexcept;
 
 	private:
 		struct section {
 			uint32_t count = 0;
+			uint32_t bytes = 0;
 			const string_key* keys = nullptr;
 			const char* strings = nullptr;
 			void close() noexcept {
 				count = 0;
+				bytes = 0;
 				keys = nullptr;
 				strings = nullptr;
 			}
 			const string_key* get(identifier id) const noexcept;
+			const string_key* get(identifier id, slot pos) const noexcept;
 			std::string_view string(identifier id) const noexcept;
+			std::string_view string(identifier id, slot pos) const noexcept;
 			std::string_view string(const string_key& key) const noexcept;
 
 			const string_key* begin() const noexcept { return keys; }
@@ -52,10 +136,54 @@ namespace lngs {
 
 			bool read_strings(const string_header* sec) noexcept;
 		};
+
+		struct templates {
+			uint32_t count = 0;
+			uint32_t bytes = 0;
+			const string_key* keys = nullptr;
+			const format_segment* segments = nullptr;
+			void close() noexcept {
+				count = 0;
+				bytes = 0;
+				keys = nullptr;
+				segments = nullptr;
+			}
+			const string_key* get(identifier id) const noexcept;
+
+			bool read_segments(const string_header* sec) noexcept;
+		};
+
+		std::size_t format_form(identifier id,
+		                        std::string_view str,
+		                        intmax_t sub,
+		                        std::string_view const* args,
+		                        std::size_t arg_count,
+		                        char* buffer,
+		                        std::size_t size) const noexcept;
+
+		plurals::lexical const& plural_rule() const;
+
 		unsigned serial;
+		uint32_t dense = 0;
 		section attrs;
 		section strings;
 		section keys;
+		templates formats;
 		mutable plurals::lexical lex;
 	};
+
+	// Splits a {fmt}-like template into literals and placeholders, with
+	// plural forms separated by segment_plural_break. A malformed form (e.g.
+	// with named arguments or unbalanced braces) becomes one literal, to be
+	// copied verbatim. Returns false, if no form is a valid template.
+	bool compile_format(std::string_view str,
+	                    std::vector<format_segment>& segments);
+
+	// Renders a single form of a string the way lang_file::format() does
+	// without a 'fmts' section, for strings kept outside of any lang_file.
+	std::size_t format_string(std::string_view str,
+	                          std::string_view const* args,
+	                          std::size_t arg_count,
+	                          char* buffer,
+	                          std::size_t size) noexcept;
 }  // namespace lngs
@@ -0,0 +1,179 @@
+// Copyright (c) 2026 midnightBITS
+// This code is licensed under MIT license (see LICENSE for details)
+
+#pragma once
+
+#include <atomic>
+#include <cstddef>
+#include <cstdint>
+#include <memory>
+#include <string>
+#include <vector>
+
+namespace lngs::stats {
+	// Counts of string lookups made through one storage object. A lookup is
+	// a get_string() or a format() call; it is empty, if the string was not
+	// found anywhere, and a fallback, if the file did not have the string,
+	// but the builtin resource did.
+	struct snapshot {
+		uint64_t lookups{};
+		uint64_t empty{};
+		uint64_t fallbacks{};
+
+		bool operator==(snapshot const& rhs) const noexcept {
+			return lookups == rhs.lookups && empty == rhs.empty &&
+			       fallbacks == rhs.fallbacks;
+		}
+		bool operator!=(snapshot const& rhs) const noexcept {
+			return !(*this == rhs);
+		}
+	};
+
+	// A string, which was shown untranslated, with its key, if the catalog
+	// has one.
+	struct missing_string {
+		uint32_t id{};
+		std::string key{};
+	};
+
+	// Ids of the strings recorded by basic_missing and the number of misses
+	// of ids too large for its bitmap, which could not be recorded.
+	struct missing_ids : std::vector<uint32_t> {
+		uint64_t overflow{};
+	};
+
+	// Default policy; compiles to nothing.
+	struct none {
+		static constexpr bool enabled = false;
+		void add(uint32_t, bool, bool = false) const noexcept {}
+		snapshot get() const noexcept { return {}; }
+		template <typename KeyOf>
+		std::vector<missing_string> missing(KeyOf&&) const {
+			return {};
+		}
+	};
+
+	// Small, stable number of the calling thread, handed out in the order
+	// the threads first ask for it.
+	inline std::size_t thread_slot() noexcept {
+		static std::atomic<std::size_t> next{0};
+		thread_local std::size_t const slot =
+		    next.fetch_add(1, std::memory_order_relaxed);
+		return slot;
+	}
+
+	// Keeps the counters in cache line sized shards, one for each of the
+	// first ShardCount threads, and wrapping around after that, so lookups
+	// from different threads do not share the line they write to. The
+	// shards are summed when get() is called. Copies of a storage object
+	// share the counters, the same way they share the translation.
+	template <std::size_t ShardCount = 16>
+	class basic_counters {
+		static_assert(ShardCount > 0);
+
+	public:
+		static constexpr bool enabled = true;
+
+		void add(uint32_t, bool empty, bool fallback = false) const noexcept {
+			auto& shard = m_shards.get()[thread_slot() % ShardCount];
+			shard.lookups.fetch_add(1, std::memory_order_relaxed);
+			if (empty) shard.empty.fetch_add(1, std::memory_order_relaxed);
+			if (fallback)
+				shard.fallbacks.fetch_add(1, std::memory_order_relaxed);
+		}
+
+		snapshot get() const noexcept {
+			snapshot result{};
+			for (std::size_t index = 0; index < ShardCount; ++index) {
+				auto const& shard = m_shards.get()[index];
+				result.lookups +=
+				    shard.lookups.load(std::memory_order_relaxed);
+				result.empty += shard.empty.load(std::memory_order_relaxed);
+				result.fallbacks +=
+				    shard.fallbacks.load(std::memory_order_relaxed);
+			}
+			return result;
+		}
+
+		template <typename KeyOf>
+		std::vector<missing_string> missing(KeyOf&&) const {
+			return {};
+		}
+
+	private:
+		struct alignas(64) cell {
+			std::atomic<uint64_t> lookups{0};
+			std::atomic<uint64_t> empty{0};
+			std::atomic<uint64_t> fallbacks{0};
+		};
+
+		std::shared_ptr<cell[]> m_shards{new cell[ShardCount]};
+	};
+
+	using counters = basic_counters<>;
+
+	// Remembers ids of strings, which were empty or came from the builtin
+	// resource, in a bitmap of Capacity bits; misses of ids past the
+	// capacity are only counted, as get().overflow. A lookup, which found
+	// the string in the file, does not touch the bitmap and a miss is at
+	// most one relaxed atomic operation, so the policy can stay on in
+	// production. get() lists the ids, missing() lists them with their
+	// keys.
+	template <uint32_t Capacity = 0x10000>
+	class basic_missing {
+		static_assert(Capacity > 0 && Capacity % 64 == 0);
+		static constexpr uint32_t word_count = Capacity / 64;
+
+	public:
+		static constexpr bool enabled = true;
+		static constexpr uint32_t capacity = Capacity;
+
+		void add(uint32_t id,
+		         bool empty,
+		         bool fallback = false) const noexcept {
+			if (!(empty || fallback)) return;
+			if (id >= Capacity) {
+				m_bits[word_count].fetch_add(1, std::memory_order_relaxed);
+				return;
+			}
+			auto& word = m_bits[id / 64];
+			auto const bit = uint64_t{1} << (id % 64);
+			if (!(word.load(std::memory_order_relaxed) & bit))
+				word.fetch_or(bit, std::memory_order_relaxed);
+		}
+
+		missing_ids get() const {
+			missing_ids ids;
+			for (uint32_t index = 0; index < word_count; ++index) {
+				auto bits = m_bits[index].load(std::memory_order_relaxed);
+				for (uint32_t bit = 0; bits; ++bit, bits >>= 1) {
+					if (bits & 1) ids.push_back(index * 64 + bit);
+				}
+			}
+			ids.overflow = m_bits[word_count].load(std::memory_order_relaxed);
+			return ids;
+		}
+
+		template <typename KeyOf>
+		std::vector<missing_string> missing(KeyOf&& key_of) const {
+			auto const ids = get();
+			std::vector<missing_string> result;
+			result.reserve(ids.size());
+			for (auto id : ids)
+				result.push_back({id, std::string{key_of(id)}});
+			return result;
+		}
+
+		void clear() const noexcept {
+			for (uint32_t index = 0; index <= word_count; ++index)
+				m_bits[index].store(0, std::memory_order_relaxed);
+		}
+
+	private:
+		// the bitmap, followed by the overflow counter
+		std::shared_ptr<std::atomic<uint64_t>[]> m_bits{
+		    new std::atomic<uint64_t>[word_count + 1]()};
+	};
+
+	using missing = basic_missing<>;
+}  // namespace lngs::stats
@@ -4,7 +4,10 @@
 #pragma once
 
 #include <assert.h>
+#include <algorithm>
 #include <limits>
+#include <lngs/lngs_stats.hpp>
+#include <lngs/lngs_trace.hpp>
 #include <lngs/translation.hpp>
 #include <string>
 #include <string_view>
@@ -14,26 +17,97 @@
 namespace lngs {
 	std::vector<std::string> system_locales(bool init_setlocale = true);
 	std::vector<std::string> http_accept_language(std::string_view header);
+
+	// Builtin strings compiled into the binary by "lngs res --static". The
+	// ids are sorted; strings (with plural forms separated by NUL) and keys,
+	// if present, are at the same index as their id.
+	struct static_table {
+		uint32_t const* ids{};
+		std::string_view const* strings{};
+		std::string_view const* keys{};
+		std::size_t count{};
+		std::string_view plurals{};
+	};
+
 	namespace storage {
-		class FileBased {
+		// Storages take a statistics policy: stats::none, stats::counters
+		// or stats::missing. statistics() returns what the policy gathered
+		// and missing_keys() the strings shown untranslated, with keys from
+		// the 'keys' section. The second policy, trace::none or
+		// trace::probes, is told about opened files, misses and plural
+		// forms.
+		template <typename Stats = stats::none, typename Trace = trace::none>
+		class BasicFileBased;
+		using FileBased = BasicFileBased<>;
+
+		template <typename Stats, typename Trace>
+		class BasicFileBased {
+			using traced = trace::lookup<Trace, trace::source::file>;
 			std::shared_ptr<translation> m_impl;
+			Stats m_stats;
 
 		protected:
 			using identifier = lang_file::identifier;
 			using quantity = lang_file::quantity;
+			using slot = lang_file::slot;
 
 			template <typename NextStorage = storage::FileBased>
 			using rebind = NextStorage;
 
 			std::string_view get_string(identifier val) const noexcept {
 				assert(m_impl);
-				return m_impl->get_string(val);
+				auto ret = m_impl->get_string(val);
+				m_stats.add(static_cast<uint32_t>(val), ret.empty());
+				traced::done(val, !ret.empty());
+				return ret;
 			}
 
 			std::string_view get_string(identifier val,
 			                            quantity count) const noexcept {
 				assert(m_impl);
-				return m_impl->get_string(val, count);
+				auto ret = m_impl->get_string(val, count);
+				m_stats.add(static_cast<uint32_t>(val), ret.empty());
+				traced::done(val, count, !ret.empty());
+				return ret;
+			}
+
+			std::string_view get_string(identifier val,
+			                            slot pos) const noexcept {
+				assert(m_impl);
+				auto ret = m_impl->get_string(val, pos);
+				m_stats.add(static_cast<uint32_t>(val), ret.empty());
+				traced::done(val, !ret.empty());
+				return ret;
+			}
+
+			std::string_view get_string(identifier val,
+			                            slot pos,
+			                            quantity count) const noexcept {
+				assert(m_impl);
+				auto ret = m_impl->get_string(val, pos, count);
+				m_stats.add(static_cast<uint32_t>(val), ret.empty());
+				traced::done(val, count, !ret.empty());
+				return ret;
+			}
+
+			// One lookup for all the counts, see lang_file::get_strings().
+			bool get_strings(identifier val,
+			                 intmax_t const* counts,
+			                 std::string_view* out,
+			                 std::size_t size) const noexcept {
+				assert(m_impl);
+				auto ret = m_impl->get_strings(val, counts, out, size);
+				m_stats.add(static_cast<uint32_t>(val), !ret);
+				traced::done(val, ret);
+				return ret;
+			}
+
+			// Index of the plural form the count selects, the same for all
+			// the strings of the file.
+			intmax_t plural_index(identifier,
+			                      quantity count) const noexcept {
+				assert(m_impl);
+				return m_impl->calc_substring(count);
 			}
 
 			std::string_view get_attr(uint32_t val) const noexcept {
@@ -51,6 +125,32 @@ namespace lngs {
 				return m_impl->find_key(val);
 			}
 
+			std::size_t format(identifier val,
+			                   std::string_view const* args,
+			                   std::size_t arg_count,
+			                   char* buffer,
+			                   std::size_t size) const noexcept {
+				assert(m_impl);
+				auto ret = m_impl->format(val, args, arg_count, buffer, size);
+				m_stats.add(static_cast<uint32_t>(val), !ret);
+				traced::done(val, ret != 0);
+				return ret;
+			}
+
+			std::size_t format(identifier val,
+			                   quantity count,
+			                   std::string_view const* args,
+			                   std::size_t arg_count,
+			                   char* buffer,
+			                   std::size_t size) const noexcept {
+				assert(m_impl);
+				auto ret = m_impl->format(val, count, args, arg_count,
+				                          buffer, size);
+				m_stats.add(static_cast<uint32_t>(val), !ret);
+				traced::done(val, count, ret != 0);
+				return ret;
+			}
+
 			template <typename C>
 			bool open_range(C&& langs, SerialNumber serial) {
 				for (auto& lang : langs) {
@@ -69,7 +169,13 @@ namespace lngs {
 
 			bool open(const std::string& lng, SerialNumber serial) {
 				assert(m_impl);
-				return m_impl->open(lng, serial);
+				if (m_impl->size())
+					Trace::reload(lng);
+				else
+					Trace::open(lng);
+				auto const ok = m_impl->open(lng, serial);
+				Trace::opened(lng, ok);
+				return ok;
 			}
 
 			template <typename T, typename C>
@@ -103,32 +209,105 @@ namespace lngs {
 				return m_impl->add_onupdate(fn);
 			}
 
+			template <typename Callback>
+			std::enable_if_t<
+			    std::is_invocable_v<Callback&, update_event const&>,
+			    uint32_t>
+			add_onupdate(Callback&& fn) {
+				assert(m_impl);
+				return m_impl->add_onupdate(std::forward<Callback>(fn));
+			}
+
 			void remove_onupdate(uint32_t token) {
 				assert(m_impl);
 				return m_impl->remove_onupdate(token);
 			}
+
+			update_metrics const& metrics() const noexcept {
+				assert(m_impl);
+				return m_impl->metrics();
+			}
+
+			memory_footprint memory_usage() const noexcept {
+				if (!m_impl) return {};
+				return m_impl->memory_usage();
+			}
+
+			auto statistics() const { return m_stats.get(); }
+
+			std::vector<stats::missing_string> missing_keys() const {
+				return m_stats.missing(
+				    [this](uint32_t id) { return get_key(id); });
+			}
 		};
 
-		template <typename ResourceT>
+		template <typename ResourceT,
+		          typename Stats = stats::none,
+		          typename Trace = trace::none>
 		class Builtin {
+			using traced = trace::lookup<Trace, trace::source::builtin>;
 			std::shared_ptr<lang_file> m_file;
+			Stats m_stats;
 
 		protected:
 			using identifier = lang_file::identifier;
 			using quantity = lang_file::quantity;
+			using slot = lang_file::slot;
 
 			template <typename NextStorage>
 			using rebind = NextStorage;
 
 			std::string_view get_string(identifier val) const noexcept {
 				assert(m_file);
-				return m_file->get_string(val);
+				auto ret = m_file->get_string(val);
+				m_stats.add(static_cast<uint32_t>(val), ret.empty());
+				traced::done(val, !ret.empty());
+				return ret;
 			}
 
 			std::string_view get_string(identifier val,
 			                            quantity count) const noexcept {
 				assert(m_file);
-				return m_file->get_string(val, count);
+				auto ret = m_file->get_string(val, count);
+				m_stats.add(static_cast<uint32_t>(val), ret.empty());
+				traced::done(val, count, !ret.empty());
+				return ret;
+			}
+
+			std::string_view get_string(identifier val,
+			                            slot pos) const noexcept {
+				assert(m_file);
+				auto ret = m_file->get_string(val, pos);
+				m_stats.add(static_cast<uint32_t>(val), ret.empty());
+				traced::done(val, !ret.empty());
+				return ret;
+			}
+
+			std::string_view get_string(identifier val,
+			                            slot pos,
+			                            quantity count) const noexcept {
+				assert(m_file);
+				auto ret = m_file->get_string(val, pos, count);
+				m_stats.add(static_cast<uint32_t>(val), ret.empty());
+				traced::done(val, count, !ret.empty());
+				return ret;
+			}
+
+			bool get_strings(identifier val,
+			                 intmax_t const* counts,
+			                 std::string_view* out,
+			                 std::size_t size) const noexcept {
+				assert(m_file);
+				auto ret = m_file->get_strings(val, counts, out, size);
+				m_stats.add(static_cast<uint32_t>(val), !ret);
+				traced::done(val, ret);
+				return ret;
+			}
+
+			intmax_t plural_index(identifier,
+			                      quantity count) const noexcept {
+				assert(m_file);
+				return m_file->calc_substring(count);
 			}
 
 			std::string_view get_attr(uint32_t val) const noexcept {
@@ -146,6 +325,32 @@ namespace lngs {
 				return m_file->find_key(val);
 			}
 
+			std::size_t format(identifier val,
+			                   std::string_view const* args,
+			                   std::size_t arg_count,
+			                   char* buffer,
+			                   std::size_t size) const noexcept {
+				assert(m_file);
+				auto ret = m_file->format(val, args, arg_count, buffer, size);
+				m_stats.add(static_cast<uint32_t>(val), !ret);
+				traced::done(val, ret != 0);
+				return ret;
+			}
+
+			std::size_t format(identifier val,
+			                   quantity count,
+			                   std::string_view const* args,
+			                   std::size_t arg_count,
+			                   char* buffer,
+			                   std::size_t size) const noexcept {
+				assert(m_file);
+				auto ret = m_file->format(val, count, args, arg_count,
+				                          buffer, size);
+				m_stats.add(static_cast<uint32_t>(val), !ret);
+				traced::done(val, count, ret != 0);
+				return ret;
+			}
+
 		public:
 			bool init_builtin() {
 				m_file = std::make_shared<lang_file>();
@@ -155,28 +360,307 @@ namespace lngs {
 				view.size = ResourceT::size();
 				return m_file->open(view);
 			}
+
+			// The resource is a part of the binary, so it counts as mapped.
+			memory_footprint memory_usage() const noexcept {
+				if (!m_file) return {};
+				auto result = m_file->memory_usage();
+				result.mapped += ResourceT::size();
+				result.heap += sizeof(lang_file);
+				return result;
+			}
+
+			auto statistics() const { return m_stats.get(); }
+
+			std::vector<stats::missing_string> missing_keys() const {
+				return m_stats.missing(
+				    [this](uint32_t id) { return get_key(id); });
+			}
 		};
 
+		// Builtin storage for resources with a static_table. There is nothing
+		// to parse or validate, so init_builtin() has nothing to do, and no
+		// lookup allocates. Strings are found with a binary search over the
+		// ids. Plural forms follow the rule of the table, which for tables
+		// made by "lngs res" is the English one, (n != 1).
+		template <typename ResourceT,
+		          typename Stats = stats::none,
+		          typename Trace = trace::none>
+		class StaticBuiltin {
+			using traced = trace::lookup<Trace, trace::source::builtin>;
+			Stats m_stats;
+
+			static constexpr static_table const& table() noexcept {
+				return ResourceT::table;
+			}
+
+			static std::string_view find(uint32_t id) noexcept {
+				auto const& tbl = table();
+				auto const end = tbl.ids + tbl.count;
+				auto const it = std::lower_bound(tbl.ids, end, id);
+				if (it == end || *it != id) return {};
+				return tbl.strings[it - tbl.ids];
+			}
+
+			// The table has every string of the definition file, sorted by
+			// id, so a slot from "lngs enums --dense" is the exact index.
+			static std::string_view find(uint32_t id,
+			                             lang_file::slot pos) noexcept {
+				auto const& tbl = table();
+				auto const index = static_cast<uint32_t>(pos);
+				if (index < tbl.count && tbl.ids[index] == id)
+					return tbl.strings[index];
+				return find(id);
+			}
+
+			static intmax_t plural_of(lang_file::quantity count) noexcept {
+				auto const& tbl = table();
+				if (tbl.plurals.empty()) return 0;
+				return static_cast<intmax_t>(count) != 1 ? 1 : 0;
+			}
+
+		protected:
+			using identifier = lang_file::identifier;
+			using quantity = lang_file::quantity;
+			using slot = lang_file::slot;
+
+			template <typename NextStorage>
+			using rebind = NextStorage;
+
+			std::string_view get_string(identifier val) const noexcept {
+				auto ret = lang_file::plural_form(
+				    find(static_cast<uint32_t>(val)), 0);
+				m_stats.add(static_cast<uint32_t>(val), ret.empty());
+				traced::done(val, !ret.empty());
+				return ret;
+			}
+
+			std::string_view get_string(identifier val,
+			                            quantity count) const noexcept {
+				auto ret = lang_file::plural_form(
+				    find(static_cast<uint32_t>(val)), plural_of(count));
+				m_stats.add(static_cast<uint32_t>(val), ret.empty());
+				traced::done(val, count, !ret.empty());
+				return ret;
+			}
+
+			std::string_view get_string(identifier val,
+			                            slot pos) const noexcept {
+				auto ret = lang_file::plural_form(
+				    find(static_cast<uint32_t>(val), pos), 0);
+				m_stats.add(static_cast<uint32_t>(val), ret.empty());
+				traced::done(val, !ret.empty());
+				return ret;
+			}
+
+			std::string_view get_string(identifier val,
+			                            slot pos,
+			                            quantity count) const noexcept {
+				auto ret = lang_file::plural_form(
+				    find(static_cast<uint32_t>(val), pos), plural_of(count));
+				m_stats.add(static_cast<uint32_t>(val), ret.empty());
+				traced::done(val, count, !ret.empty());
+				return ret;
+			}
+
+			bool get_strings(identifier val,
+			                 intmax_t const* counts,
+			                 std::string_view* out,
+			                 std::size_t size) const noexcept {
+				auto const str = find(static_cast<uint32_t>(val));
+				auto const singular = lang_file::plural_form(str, 0);
+				auto const plural = lang_file::plural_form(str, 1);
+				auto const with_plurals = !table().plurals.empty();
+				for (std::size_t index = 0; index < size; ++index) {
+					out[index] =
+					    with_plurals && counts[index] != 1 ? plural : singular;
+				}
+				m_stats.add(static_cast<uint32_t>(val), str.empty());
+				traced::done(val, !str.empty());
+				return !str.empty();
+			}
+
+			intmax_t plural_index(identifier,
+			                      quantity count) const noexcept {
+				return plural_of(count);
+			}
+
+			std::string_view get_attr(uint32_t val) const noexcept {
+				if (val == ATTR_PLURALS) return table().plurals;
+				return {};
+			}
+
+			std::string_view get_key(uint32_t val) const noexcept {
+				auto const& tbl = table();
+				if (!tbl.keys) return {};
+				auto const end = tbl.ids + tbl.count;
+				auto const it = std::lower_bound(tbl.ids, end, val);
+				if (it == end || *it != val) return {};
+				return tbl.keys[it - tbl.ids];
+			}
+
+			uint32_t find_key(std::string_view val) const noexcept {
+				auto const& tbl = table();
+				if (tbl.keys && !val.empty()) {
+					for (std::size_t index = 0; index < tbl.count; ++index) {
+						if (tbl.keys[index] == val) return tbl.ids[index];
+					}
+				}
+				return std::numeric_limits<uint32_t>::max();
+			}
+
+			std::size_t format(identifier val,
+			                   std::string_view const* args,
+			                   std::size_t arg_count,
+			                   char* buffer,
+			                   std::size_t size) const noexcept {
+				auto const str = lang_file::plural_form(
+				    find(static_cast<uint32_t>(val)), 0);
+				auto ret = str.empty() ? 0
+				                       : format_string(str, args, arg_count,
+				                                       buffer, size);
+				m_stats.add(static_cast<uint32_t>(val), !ret);
+				traced::done(val, ret != 0);
+				return ret;
+			}
+
+			std::size_t format(identifier val,
+			                   quantity count,
+			                   std::string_view const* args,
+			                   std::size_t arg_count,
+			                   char* buffer,
+			                   std::size_t size) const noexcept {
+				auto const str = lang_file::plural_form(
+				    find(static_cast<uint32_t>(val)), plural_of(count));
+				auto ret = str.empty() ? 0
+				                       : format_string(str, args, arg_count,
+				                                       buffer, size);
+				m_stats.add(static_cast<uint32_t>(val), !ret);
+				traced::done(val, count, ret != 0);
+				return ret;
+			}
+
+		public:
+			bool init_builtin() noexcept { return true; }
+
+			// The table is a part of the binary, so it counts as mapped.
+			memory_footprint memory_usage() const noexcept {
+				auto const& tbl = table();
+				memory_footprint result{};
+				result.mapped = tbl.plurals.size() +
+				                tbl.count * (sizeof(uint32_t) +
+				                             sizeof(std::string_view));
+				if (tbl.keys)
+					result.mapped += tbl.count * sizeof(std::string_view);
+				result.sections.attrs = tbl.plurals.size();
+				for (std::size_t index = 0; index < tbl.count; ++index) {
+					result.sections.strings += tbl.strings[index].size();
+					if (tbl.keys)
+						result.sections.keys += tbl.keys[index].size();
+				}
+				result.mapped +=
+				    result.sections.strings + result.sections.keys;
+				return result;
+			}
+
+			auto statistics() const { return m_stats.get(); }
+
+			std::vector<stats::missing_string> missing_keys() const {
+				return m_stats.missing(
+				    [this](uint32_t id) { return get_key(id); });
+			}
+		};
+
+		template <typename ResourceT, typename = void>
+		struct has_static_table : std::false_type {};
 		template <typename ResourceT>
-		class FileWithBuiltin : private FileBased, private Builtin<ResourceT> {
-			using B1 = FileBased;
-			using B2 = Builtin<ResourceT>;
+		struct has_static_table<ResourceT,
+		                        std::void_t<decltype(ResourceT::table)>>
+		    : std::true_type {};
+
+		// Builtin for resources with data() and size(), StaticBuiltin for
+		// the ones with a static_table.
+		template <typename ResourceT, typename Stats, typename Trace>
+		using builtin_for =
+		    std::conditional_t<has_static_table<ResourceT>::value,
+		                       StaticBuiltin<ResourceT, Stats, Trace>,
+		                       Builtin<ResourceT, Stats, Trace>>;
+
+		template <typename ResourceT,
+		          typename Stats = stats::none,
+		          typename Trace = trace::none>
+		class FileWithBuiltin
+		    : private BasicFileBased<stats::none, Trace>,
+		      private builtin_for<ResourceT, stats::none, Trace> {
+			using B1 = BasicFileBased<stats::none, Trace>;
+			using B2 = builtin_for<ResourceT, stats::none, Trace>;
+			Stats m_stats;
 
 		protected:
 			using identifier = lang_file::identifier;
 			using quantity = lang_file::quantity;
+			using slot = lang_file::slot;
 
 			std::string_view get_string(identifier val) const noexcept {
 				auto ret = B1::get_string(val);
-				if (!ret.empty()) return ret;
-				return B2::get_string(val);
+				if (!ret.empty()) {
+					m_stats.add(static_cast<uint32_t>(val), false);
+					return ret;
+				}
+				return fallback(val, B2::get_string(val));
 			}
 
 			std::string_view get_string(identifier val,
 			                            quantity count) const noexcept {
 				auto ret = B1::get_string(val, count);
-				if (!ret.empty()) return ret;
-				return B2::get_string(val, count);
+				if (!ret.empty()) {
+					m_stats.add(static_cast<uint32_t>(val), false);
+					return ret;
+				}
+				return fallback(val, B2::get_string(val, count));
+			}
+
+			std::string_view get_string(identifier val,
+			                            slot pos) const noexcept {
+				auto ret = B1::get_string(val, pos);
+				if (!ret.empty()) {
+					m_stats.add(static_cast<uint32_t>(val), false);
+					return ret;
+				}
+				return fallback(val, B2::get_string(val, pos));
+			}
+
+			std::string_view get_string(identifier val,
+			                            slot pos,
+			                            quantity count) const noexcept {
+				auto ret = B1::get_string(val, pos, count);
+				if (!ret.empty()) {
+					m_stats.add(static_cast<uint32_t>(val), false);
+					return ret;
+				}
+				return fallback(val, B2::get_string(val, pos, count));
+			}
+
+			bool get_strings(identifier val,
+			                 intmax_t const* counts,
+			                 std::string_view* out,
+			                 std::size_t size) const noexcept {
+				if (B1::get_strings(val, counts, out, size)) {
+					m_stats.add(static_cast<uint32_t>(val), false);
+					return true;
+				}
+				auto const ret = B2::get_strings(val, counts, out, size);
+				m_stats.add(static_cast<uint32_t>(val), !ret, ret);
+				return ret;
+			}
+
+			// The file and the builtin strings may have different plural
+			// rules; the form comes from the one, which has the string.
+			intmax_t plural_index(identifier val,
+			                      quantity count) const noexcept {
+				if (!B1::get_string(val).empty())
+					return B1::plural_index(val, count);
+				return B2::plural_index(val, count);
 			}
 
 			std::string_view get_attr(uint32_t val) const noexcept {
@@ -197,14 +681,72 @@ namespace lngs {
 				return B2::find_key(val);
 			}
 
+			std::size_t format(identifier val,
+			                   std::string_view const* args,
+			                   std::size_t arg_count,
+			                   char* buffer,
+			                   std::size_t size) const noexcept {
+				auto ret = B1::format(val, args, arg_count, buffer, size);
+				if (ret) {
+					m_stats.add(static_cast<uint32_t>(val), false);
+					return ret;
+				}
+				return fallback(
+				    val, B2::format(val, args, arg_count, buffer, size));
+			}
+
+			std::size_t format(identifier val,
+			                   quantity count,
+			                   std::string_view const* args,
+			                   std::size_t arg_count,
+			                   char* buffer,
+			                   std::size_t size) const noexcept {
+				auto ret =
+				    B1::format(val, count, args, arg_count, buffer, size);
+				if (ret) {
+					m_stats.add(static_cast<uint32_t>(val), false);
+					return ret;
+				}
+				return fallback(val, B2::format(val, count, args, arg_count,
+				                                buffer, size));
+			}
+
 		public:
-			using FileBased::add_onupdate;
-			using FileBased::known;
-			using FileBased::open;
-			using FileBased::open_first_of;
-			using FileBased::path_manager;
-			using FileBased::remove_onupdate;
-			using Builtin<ResourceT>::init_builtin;
+			using B1::add_onupdate;
+			using B1::known;
+			using B1::metrics;
+			using B1::open;
+			using B1::open_first_of;
+			using B1::path_manager;
+			using B1::remove_onupdate;
+			using B2::init_builtin;
+
+			memory_footprint memory_usage() const noexcept {
+				auto result = B1::memory_usage();
+				result += B2::memory_usage();
+				return result;
+			}
+
+			auto statistics() const { return m_stats.get(); }
+
+			std::vector<stats::missing_string> missing_keys() const {
+				return m_stats.missing(
+				    [this](uint32_t id) { return get_key(id); });
+			}
+
+		private:
+			std::string_view fallback(identifier val,
+			                          std::string_view ret) const noexcept {
+				m_stats.add(static_cast<uint32_t>(val), ret.empty(),
+				            !ret.empty());
+				return ret;
+			}
+
+			std::size_t fallback(identifier val,
+			                     std::size_t ret) const noexcept {
+				m_stats.add(static_cast<uint32_t>(val), !ret, ret != 0);
+				return ret;
+			}
 		};
 	}  // namespace storage
 }  // namespace lngs
@@ -0,0 +1,87 @@
+// Copyright (c) 2026 midnightBITS
+// This code is licensed under MIT license (see LICENSE for details)
+
+#pragma once
+
+#include <cstdint>
+#include <lngs/lngs_file.hpp>
+#include <string_view>
+
+#if defined(__has_include)
+#if __has_include(<sys/sdt.h>)
+#include <sys/sdt.h>
+#define LNGS_HAS_SDT 1
+#endif
+#endif
+
+namespace lngs::trace {
+	enum class source : uint32_t { file, builtin };
+
+	// Tracing policy of the storage classes. Every hook is a static
+	// function, so a policy adds no state to the storage and the calls to
+	// an empty one compile away. A custom policy, e.g. one forwarding to
+	// an application's tracer, has to provide the same five functions:
+	//
+	//  - open(lang) and reload(lang), when a file is about to be opened;
+	//    reload(), if the storage had a file loaded before,
+	//  - opened(lang, ok), once the file was opened (or not),
+	//  - miss(id, source), when the file, or the builtin resource, had no
+	//    string for the id,
+	//  - plural(id, count), when a plural form is chosen for a count.
+	struct none {
+		static constexpr bool enabled = false;
+		static void open(std::string_view) noexcept {}
+		static void reload(std::string_view) noexcept {}
+		static void opened(std::string_view, bool) noexcept {}
+		static void miss(uint32_t, source) noexcept {}
+		static void plural(uint32_t, intmax_t) noexcept {}
+	};
+
+	// Emits USDT/SDT probes in the "lngs" provider, named after the hooks:
+	//
+	//   bpftrace -e 'usdt:./app:lngs:miss { @[arg0, arg1] = count(); }'
+	//
+	// The language names are passed as NUL-terminated strings. Without
+	// <sys/sdt.h> (from systemtap-sdt-dev or similar) the probes are not
+	// compiled in and this policy behaves like trace::none.
+#ifdef LNGS_HAS_SDT
+	struct probes {
+		static constexpr bool enabled = true;
+		static void open(std::string_view lang) noexcept {
+			DTRACE_PROBE1(lngs, open, lang.data());
+		}
+		static void reload(std::string_view lang) noexcept {
+			DTRACE_PROBE1(lngs, reload, lang.data());
+		}
+		static void opened(std::string_view lang, bool ok) noexcept {
+			DTRACE_PROBE2(lngs, opened, lang.data(), ok ? 1 : 0);
+		}
+		static void miss(uint32_t id, source where) noexcept {
+			DTRACE_PROBE2(lngs, miss, id, static_cast<uint32_t>(where));
+		}
+		static void plural(uint32_t id, intmax_t count) noexcept {
+			DTRACE_PROBE2(lngs, plural, id, count);
+		}
+	};
+#else
+	struct probes : none {};
+#endif
+
+	// Turns the result of a lookup in Where into miss() or plural() calls.
+	template <typename Trace, source Where>
+	struct lookup {
+		static void done(lang_file::identifier id, bool found) noexcept {
+			if (!found) Trace::miss(static_cast<uint32_t>(id), Where);
+		}
+
+		static void done(lang_file::identifier id,
+		                 lang_file::quantity count,
+		                 bool found) noexcept {
+			if (found)
+				Trace::plural(static_cast<uint32_t>(id),
+				              static_cast<intmax_t>(count));
+			else
+				Trace::miss(static_cast<uint32_t>(id), Where);
+		}
+	};
+}  // namespace lngs::trace
@@ -3,29 +3,91 @@
 
 #pragma once
 
+#include <cstddef>
+#include <cstdint>
 #include <memory>
 #include <string_view>
 
 namespace lngs::plurals {
 	struct expr {
+		// Most counts eval_many() is called with at once.
+		static constexpr std::size_t batch = 64;
+
 		virtual ~expr() noexcept {}
 		virtual intmax_t eval(intmax_t n, bool& failed) const noexcept = 0;
+		// Evaluates a column of up to batch counts; failed[index] is set
+		// for counts, for which eval() would have failed, and left alone
+		// otherwise. The nodes of lexical evaluate their operands for the
+		// whole column, so the loops combining them have no branches.
+		virtual void eval_many(intmax_t const* n,
+		                       intmax_t* out,
+		                       bool* failed,
+		                       std::size_t size) const noexcept {
+			for (std::size_t index = 0; index < size; ++index) {
+				bool item_failed = false;
+				out[index] = eval(n[index], item_failed);
+				if (item_failed) failed[index] = true;
+			}
+		}
+		// Bytes allocated for this node and its operands.
+		virtual std::size_t heap_bytes() const noexcept { return 0; }
 	};
 
+	// Plural rule compiled into the program, see "lngs res --plurals".
+	using native_rule = intmax_t (*)(intmax_t n) noexcept;
+
 	struct lexical {
 		int nplurals{0};
-		std::unique_ptr<expr> plural{};
-
-		lexical() = default;
-		~lexical() = default;
-		lexical(const lexical&) = delete;
-		lexical(lexical&&) = default;
-		lexical& operator=(const lexical&) = delete;
-		lexical& operator=(lexical&&) = default;
+		// Never changed after parsing, so copies share the tree.
+		std::shared_ptr<expr const> plural{};
+		native_rule native{nullptr};
 
 		intmax_t eval(intmax_t n) const noexcept;
-		explicit operator bool() const noexcept { return !!plural; }
+		// Same as calling eval() for every count, with results outside of
+		// 0-255 stored as 255, which no string has a form for.
+		void eval_many(intmax_t const* counts,
+		               uint8_t* forms,
+		               std::size_t size) const noexcept;
+		std::size_t heap_bytes() const noexcept {
+			return plural ? plural->heap_bytes() : 0;
+		}
+		explicit operator bool() const noexcept { return plural || native; }
 	};
 
 	lexical decode(std::string_view entry);
+	// Same as intern(entry), unless a native rule was registered for the
+	// culture with the same Plural-Forms; then, the rule is used and the
+	// entry is not parsed at all.
+	lexical decode(std::string_view entry, std::string_view culture);
+	// Same as decode(entry), but the result is kept in a process-wide table
+	// under the entry without its spaces, and every later call for the same
+	// rule gets a copy, sharing the parsed tree, instead of parsing it
+	// again. Safe to call from any thread.
+	lexical intern(std::string_view entry);
+
+	// The strings are not copied and have to outlive the registration;
+	// forms is compared with the Plural-Forms of a file, ignoring spaces.
+	struct native {
+		std::string_view culture{};
+		std::string_view forms{};
+		int nplurals{0};
+		native_rule rule{nullptr};
+	};
+
+	// Safe to call from any thread; a later registration for the same
+	// culture and forms replaces the earlier one. If nothing was found, the
+	// rule in the result is null.
+	void register_native(native const& entry);
+	native find_native(std::string_view culture,
+	                   std::string_view forms) noexcept;
+
+	// Registers the rules from the code generated by lngs res, when the
+	// program starts.
+	struct native_registrar {
+		template <std::size_t Size>
+		explicit native_registrar(native const (&entries)[Size]) {
+			for (auto const& entry : entries)
+				register_native(entry);
+		}
+	};
 }  // namespace lngs::plurals
@@ -3,10 +3,13 @@
 
 #pragma once
 
+#include <array>
+#include <chrono>
 #include <filesystem>
 #include <functional>
 #include <lngs/lngs_file.hpp>
 #include <map>
+#include <type_traits>
 #include <vector>
 
 namespace lngs {
@@ -84,6 +87,30 @@ namespace lngs {
 		std::vector<std::byte> block;
 	};
 
+	// Read-only view of a whole file, mapped into the address space of the
+	// process instead of being copied. Empty, if the file could not be mapped.
+	class mapped_file : public memory_view {
+	public:
+		mapped_file() = default;
+		mapped_file(mapped_file&& other) noexcept { swap(other); }
+		mapped_file& operator=(mapped_file&& other) noexcept {
+			mapped_file{std::move(other)}.swap(*this);
+			return *this;
+		}
+		~mapped_file();
+
+		static mapped_file open(const std::filesystem::path& path) noexcept;
+
+	private:
+		std::size_t m_length{};
+
+		void swap(mapped_file& other) noexcept {
+			std::swap(contents, other.contents);
+			std::swap(size, other.size);
+			std::swap(m_length, other.m_length);
+		}
+	};
+
 	struct culture {
 		std::string lang;
 		std::string name;
@@ -93,6 +120,55 @@ namespace lngs {
 		UseAny = std::numeric_limits<unsigned>::max()
 	};
 
+	// Passed to the onupdate listeners after each translation::open(). The
+	// read_time covers reading the file into memory, the validate_time, the
+	// lang_file::open() over what was read. A file, which could not be read,
+	// has no bytes and no validate_time.
+	struct update_event {
+		std::filesystem::path path;
+		std::string lang;
+		uintmax_t bytes{};
+		std::chrono::nanoseconds read_time{};
+		std::chrono::nanoseconds validate_time{};
+		uint32_t strings{};
+		bool serial_mismatch{};
+		bool ok{};
+	};
+
+	// Durations in power-of-two buckets of microseconds: bucket 0 counts
+	// anything under 1us, bucket N, [2^(N-1), 2^N) us, and the last bucket
+	// everything longer. Once the count reaches the window, all buckets are
+	// halved, so the older samples fade out and the shape follows the
+	// recent opens.
+	class duration_histogram {
+	public:
+		static constexpr std::size_t bucket_count = 24;
+		static constexpr uint64_t window = 256;
+
+		void add(std::chrono::nanoseconds duration) noexcept;
+		void clear() noexcept { *this = {}; }
+
+		std::array<uint64_t, bucket_count> const& buckets() const noexcept {
+			return m_buckets;
+		}
+		uint64_t count() const noexcept { return m_count; }
+		std::chrono::nanoseconds last() const noexcept { return m_last; }
+		std::chrono::nanoseconds max() const noexcept { return m_max; }
+
+		static std::size_t bucket_of(std::chrono::nanoseconds) noexcept;
+
+	private:
+		std::array<uint64_t, bucket_count> m_buckets{};
+		uint64_t m_count{};
+		std::chrono::nanoseconds m_last{};
+		std::chrono::nanoseconds m_max{};
+	};
+
+	struct update_metrics {
+		duration_histogram read;
+		duration_histogram validate;
+	};
+
 	class translation {
 		struct manager_t {
 			virtual ~manager_t() {}
@@ -132,16 +208,20 @@ namespace lngs {
 			return time;
 		}
 
-		std::map<uint32_t, std::function<void()>> m_updatelisteners;
+		using listener = std::function<void(update_event const&)>;
+		std::map<uint32_t, listener> m_updatelisteners;
 		uint32_t m_nextupdate = 0xba5e0000;
+		update_metrics m_metrics;
 
 		friend class translation_tests;
 
-		void onupdate();
+		void onupdate(update_event const&);
+		uint32_t add_listener(listener fn);
 
 	public:
 		using identifier = lang_file::identifier;
 		using quantity = lang_file::quantity;
+		using slot = lang_file::slot;
 
 		static memory_block open_file(
 		    const std::filesystem::path& path) noexcept;
@@ -153,15 +233,46 @@ namespace lngs {
 
 		bool open(const std::string& lng, SerialNumber serial);
 		bool fresh() const noexcept { return mtime() == m_mtime; }
+		uint32_t size() const noexcept { return m_file.size(); }
 		std::string_view get_string(identifier id) const noexcept;
 		std::string_view get_string(identifier id,
 		                            quantity count) const noexcept;
+		std::string_view get_string(identifier id, slot pos) const noexcept;
+		std::string_view get_string(identifier id,
+		                            slot pos,
+		                            quantity count) const noexcept;
+		bool get_strings(identifier id,
+		                 intmax_t const* counts,
+		                 std::string_view* out,
+		                 std::size_t size) const noexcept;
+		intmax_t calc_substring(quantity count) const;
 		std::string_view get_attr(uint32_t id) const noexcept;
 		std::string_view get_key(uint32_t id) const noexcept;
 		uint32_t find_key(std::string_view id) const noexcept;
+		std::size_t format(identifier id,
+		                   std::string_view const* args,
+		                   std::size_t arg_count,
+		                   char* buffer,
+		                   std::size_t size) const noexcept;
+		std::size_t format(identifier id,
+		                   quantity count,
+		                   std::string_view const* args,
+		                   std::size_t arg_count,
+		                   char* buffer,
+		                   std::size_t size) const noexcept;
 		std::vector<culture> known() const;
+		update_metrics const& metrics() const noexcept { return m_metrics; }
+		memory_footprint memory_usage() const noexcept;
 
+		// Listeners either take no arguments, or the update_event.
 		uint32_t add_onupdate(const std::function<void()>&);
+		template <typename Callback>
+		std::enable_if_t<
+		    std::is_invocable_v<Callback&, update_event const&>,
+		    uint32_t>
+		add_onupdate(Callback&& fn) {
+			return add_listener(std::forward<Callback>(fn));
+		}
 		void remove_onupdate(uint32_t token);
 	};
 }  // namespace lngs
@@ -0,0 +1,70 @@
+// Copyright (c) 2026 midnightBITS
+// This code is licensed under MIT license (see LICENSE for details)
+
+#include "format.hpp"
+#include <algorithm>
+#include <lngs/lngs_file.hpp>
+
+namespace lngs {
+	namespace {
+		struct compiler {
+			std::vector<format_segment>& out;
+			uint32_t form_offset{};
+
+			void literal(uint32_t offset, uint32_t length) {
+				out.push_back({form_offset + offset, length});
+			}
+
+			void arg(uint32_t index) {
+				out.push_back({index, segment_placeholder});
+			}
+
+			void plural_break() { out.push_back({0, segment_plural_break}); }
+		};
+	}  // namespace
+
+	bool compile_format(std::string_view str,
+	                    std::vector<format_segment>& segments) {
+		auto const size = segments.size();
+		compiler sink{segments};
+		bool compiled = false;
+
+		size_t start = 0;
+		while (true) {
+			auto const end = std::min(str.find('\0', start), str.size());
+			auto const form = str.substr(start, end - start);
+			auto const form_size = segments.size();
+
+			sink.form_offset = static_cast<uint32_t>(start);
+			if (placeholders::scan(form, sink)) {
+				compiled = true;
+			} else {
+				// copied as it is, the same as lang_file::format() does for
+				// a form, which is not a valid template
+				segments.resize(form_size);
+				sink.literal(0, static_cast<uint32_t>(form.size()));
+			}
+
+			if (end == str.size()) break;
+			sink.plural_break();
+			start = end + 1;
+		}
+
+		if (compiled) return true;
+		segments.resize(size);
+		return false;
+	}
+
+	std::size_t format_string(std::string_view str,
+	                          std::string_view const* args,
+	                          std::size_t arg_count,
+	                          char* buffer,
+	                          std::size_t size) noexcept {
+		placeholders::writer out{buffer, size, str, args, arg_count};
+		if (!placeholders::scan(str, out)) {
+			out.pos = 0;
+			out.put(str);
+		}
+		return out.pos;
+	}
+}  // namespace lngs
@@ -0,0 +1,120 @@
+// Copyright (c) 2026 midnightBITS
+// This code is licensed under MIT license (see LICENSE for details)
+
+#pragma once
+
+#include <cstring>
+#include <lngs/lngs_base.hpp>
+#include <string_view>
+
+namespace lngs::placeholders {
+	// Walks a {fmt}-like template, calling sink.literal(offset, length),
+	// sink.arg(index) and sink.plural_break() for every part found. Supports
+	// "{{", "}}", "{}" and "{N}", format specs ("{N:...}") are accepted and
+	// ignored. Automatic numbering restarts with each plural form.
+	template <typename Sink>
+	bool scan(std::string_view str, Sink& sink) noexcept {
+		constexpr uint32_t max_index = 0xFFFFu;
+		uint32_t next_arg = 0;
+		size_t start = 0;
+		size_t pos = 0;
+		auto const size = str.size();
+
+		auto flush = [&](size_t end) {
+			if (end > start)
+				sink.literal(static_cast<uint32_t>(start),
+				             static_cast<uint32_t>(end - start));
+		};
+
+		while (pos < size) {
+			auto const c = str[pos];
+			if (c == '\0') {
+				flush(pos);
+				sink.plural_break();
+				next_arg = 0;
+				start = ++pos;
+				continue;
+			}
+
+			if (c == '}') {
+				if (pos + 1 >= size || str[pos + 1] != '}') return false;
+				flush(pos + 1);
+				start = pos = pos + 2;
+				continue;
+			}
+
+			if (c != '{') {
+				++pos;
+				continue;
+			}
+
+			if (pos + 1 < size && str[pos + 1] == '{') {
+				flush(pos + 1);
+				start = pos = pos + 2;
+				continue;
+			}
+
+			flush(pos);
+			++pos;
+
+			auto index = next_arg;
+			bool manual = false;
+			while (pos < size && str[pos] >= '0' && str[pos] <= '9') {
+				if (!manual) index = 0;
+				manual = true;
+				index = index * 10 + static_cast<uint32_t>(str[pos] - '0');
+				if (index > max_index) return false;
+				++pos;
+			}
+			if (!manual) ++next_arg;
+
+			if (pos < size && str[pos] == ':') {
+				int depth = 0;
+				++pos;
+				while (pos < size && (depth || str[pos] != '}')) {
+					if (str[pos] == '\0') return false;
+					if (str[pos] == '{') ++depth;
+					if (str[pos] == '}') --depth;
+					++pos;
+				}
+			}
+
+			if (pos >= size || str[pos] != '}') return false;
+
+			sink.arg(index);
+			start = ++pos;
+		}
+
+		flush(pos);
+		return true;
+	}
+
+	struct writer {
+		char* buffer;
+		std::size_t size;
+		std::string_view str;
+		std::string_view const* args;
+		std::size_t arg_count;
+		std::size_t pos = 0;
+
+		void put(std::string_view chunk) noexcept {
+			if (pos < size) {
+				auto const rest = size - pos;
+				std::memcpy(buffer + pos, chunk.data(),
+				            chunk.size() < rest ? chunk.size() : rest);
+			}
+			pos += chunk.size();
+		}
+
+		void literal(uint32_t offset, uint32_t length) noexcept {
+			if (offset > str.size() || length > str.size() - offset) return;
+			put(str.substr(offset, length));
+		}
+
+		void arg(uint32_t index) noexcept {
+			if (index < arg_count) put(args[index]);
+		}
+
+		void plural_break() noexcept {}
+	};
+}  // namespace lngs::placeholders
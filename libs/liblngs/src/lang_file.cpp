@@ -1,20 +1,49 @@
 // Copyright (c) 2015 midnightBITS
 // This code is licensed under MIT license (see LICENSE for details)
 
+#include <algorithm>
 #include <cstring>
 #include <limits>
 #include <lngs/lngs_file.hpp>
+#include "format.hpp"
 
 namespace lngs {
-	const string_key* lang_file::section::get(identifier id) const noexcept {
-		const auto comp = static_cast<uint32_t>(id);
-		auto end = keys + count;
-		auto cur = keys;
-		while (end != cur) {
-			if (cur->id == comp) return cur;
-			++cur;
+	namespace {
+		const string_key* find_id(const string_key* keys,
+		                          uint32_t count,
+		                          lang_file::identifier id) noexcept {
+			const auto comp = static_cast<uint32_t>(id);
+			auto end = keys + count;
+			auto cur = keys;
+			while (end != cur) {
+				if (cur->id == comp) return cur;
+				++cur;
+			}
+			return nullptr;
+		}
+
+		uint32_t section_bytes(const section_header* sec) noexcept {
+			return static_cast<uint32_t>(
+			    (sec->ints + sizeof(section_header) / sizeof(uint32_t)) *
+			    sizeof(uint32_t));
 		}
-		return nullptr;
+	}  // namespace
+
+	const string_key* lang_file::section::get(identifier id) const noexcept {
+		return find_id(keys, count, id);
+	}
+
+	const string_key* lang_file::section::get(identifier id,
+	                                          slot pos) const noexcept {
+		auto const index = static_cast<uint32_t>(pos);
+		if (index < count && keys[index].id == static_cast<uint32_t>(id))
+			return keys + index;
+		return find_id(keys, count, id);
+	}
+
+	const string_key* lang_file::templates::get(
+	    identifier id) const noexcept {
+		return find_id(keys, count, id);
 	}
 
 	std::string_view lang_file::section::string(identifier id) const noexcept {
@@ -24,6 +53,14 @@ namespace lngs {
 		return {key->offset + strings, key->length};
 	}
 
+	std::string_view lang_file::section::string(identifier id,
+	                                            slot pos) const noexcept {
+		auto key = get(id, pos);
+		if (!key) return {};
+
+		return {key->offset + strings, key->length};
+	}
+
 	std::string_view lang_file::section::string(
 	    const string_key& key) const noexcept {
 		return {key.offset + strings, key.length};
@@ -61,11 +98,48 @@ namespace lngs {
 		}
 
 		count = sec->string_count;
+		bytes = section_bytes(sec);
 		strings = in_strings;
 		keys = in_keys;
 		return true;
 	}
 
+	bool lang_file::templates::read_segments(
+	    const string_header* sec) noexcept {
+		close();
+
+		if (sec->string_offset - sizeof(section_header) / sizeof(uint32_t) >
+		    sec->ints)
+			return false;
+
+		auto uints_for_keys =
+		    sec->string_offset - sizeof(string_header) / sizeof(uint32_t);
+		if (uints_for_keys <
+		    sec->string_count * sizeof(string_key) / sizeof(uint32_t))
+			return false;
+
+		const auto segment_count =
+		    (sec->ints + sizeof(section_header) / sizeof(uint32_t) -
+		     sec->string_offset) *
+		    sizeof(uint32_t) / sizeof(format_segment);
+
+		auto in_keys = reinterpret_cast<const string_key*>(sec + 1);
+		auto in_segments = reinterpret_cast<const format_segment*>(
+		    reinterpret_cast<const uint32_t*>(sec) + sec->string_offset);
+		for (auto cur = in_keys, end = in_keys + sec->string_count; cur != end;
+		     ++cur) {
+			auto& key = *cur;
+			if (key.offset > segment_count) return false;
+			if (key.length > segment_count - key.offset) return false;
+		}
+
+		count = sec->string_count;
+		bytes = section_bytes(sec);
+		segments = in_segments;
+		keys = in_keys;
+		return true;
+	}
+
 	bool lang_file::open(const memory_view& view) noexcept {
 		constexpr uint32_t header_size = sizeof(uint32_t) + sizeof(file_header);
 		constexpr uint32_t ver_1_x = 0x0000FFFFu;
@@ -88,6 +162,7 @@ namespace lngs {
 		}
 
 		serial = fhdr->serial;
+		dense = 0;
 
 		auto sec = static_cast<section_header const*>(fhdr);
 		while (sec->id != lasttext_tag) {
@@ -109,16 +184,37 @@ namespace lngs {
 				case keystext_tag:
 					if (!keys.read_strings(strsec)) return false;
 					break;
+				case fmtstext_tag:
+					if (!formats.read_segments(strsec)) return false;
+					break;
+				case denstext_tag:
+					if (!sec->ints) return false;
+					dense = *reinterpret_cast<const uint32_t*>(sec + 1);
+					break;
 			}
 		}
 
-		return true;
+		// a file claiming to be dense has to have all the slots
+		return dense == 0 || dense == strings.count;
 	}
 
 	void lang_file::close() noexcept {
+		dense = 0;
 		attrs.close();
 		strings.close();
 		keys.close();
+		formats.close();
+		lex = {};
+	}
+
+	memory_footprint lang_file::memory_usage() const noexcept {
+		memory_footprint result{};
+		result.heap = lex.heap_bytes();
+		result.sections.attrs = attrs.bytes;
+		result.sections.strings = strings.bytes;
+		result.sections.keys = keys.bytes;
+		result.sections.formats = formats.bytes;
+		return result;
 	}
 
 	unsigned lang_file::get_serial() const noexcept { return serial; }
@@ -133,8 +229,66 @@ namespace lngs {
 		const auto str = strings.string(id);
 		if (str.empty()) return str;
 
-		intmax_t sub = calc_substring(count);
+		return plural_form(str, calc_substring(count));
+	}
+
+	std::string_view lang_file::get_string(identifier id,
+	                                       slot pos) const noexcept {
+		const auto ret = strings.string(id, pos);
+		return ret.substr(0, ret.find('\x00', 0));
+	}
+
+	std::string_view lang_file::get_string(identifier id,
+	                                       slot pos,
+	                                       quantity count) const noexcept {
+		const auto str = strings.string(id, pos);
+		if (str.empty()) return str;
+
+		return plural_form(str, calc_substring(count));
+	}
 
+	bool lang_file::get_strings(identifier id,
+	                            intmax_t const* counts,
+	                            std::string_view* out,
+	                            std::size_t size) const noexcept {
+		const auto str = strings.string(id);
+		if (str.empty()) {
+			std::fill(out, out + size, std::string_view{});
+			return false;
+		}
+
+		// past the last form, plural_form() gives the first one; strings
+		// with more forms, than fit here, use it for the rest
+		static constexpr std::size_t max_forms = 16;
+		std::string_view forms[max_forms];
+		std::size_t form_count = 0;
+		for (auto rest = str; form_count < max_forms;) {
+			auto const pos = rest.find('\x00', 0);
+			forms[form_count++] = rest.substr(0, pos);
+			if (pos == std::string_view::npos) break;
+			rest = rest.substr(pos + 1);
+		}
+		auto const complete = form_count < max_forms;
+
+		uint8_t chosen[plurals::expr::batch];
+		while (size) {
+			auto const chunk = std::min(size, plurals::expr::batch);
+			calc_substrings(counts, chosen, chunk);
+			for (std::size_t index = 0; index < chunk; ++index) {
+				auto const sub = chosen[index];
+				out[index] = sub < form_count ? forms[sub]
+				             : complete       ? forms[0]
+				                              : plural_form(str, sub);
+			}
+			counts += chunk;
+			out += chunk;
+			size -= chunk;
+		}
+		return true;
+	}
+
+	std::string_view lang_file::plural_form(std::string_view str,
+	                                        intmax_t sub) noexcept {
 		auto cur = str;
 		while (sub--) {
 			auto pos = cur.find('\x00', 0);
@@ -170,15 +324,87 @@ namespace lngs {
 		return std::numeric_limits<uint32_t>::max();
 	}
 
-	intmax_t lang_file::calc_substring(quantity count) const {
+	std::size_t lang_file::format(identifier id,
+	                              std::string_view const* args,
+	                              std::size_t arg_count,
+	                              char* buffer,
+	                              std::size_t size) const noexcept {
+		return format_form(id, strings.string(id), 0, args, arg_count, buffer,
+		                   size);
+	}
+
+	std::size_t lang_file::format(identifier id,
+	                              quantity count,
+	                              std::string_view const* args,
+	                              std::size_t arg_count,
+	                              char* buffer,
+	                              std::size_t size) const noexcept {
+		auto const str = strings.string(id);
+		if (str.empty()) return 0;
+		return format_form(id, str, calc_substring(count), args, arg_count,
+		                   buffer, size);
+	}
+
+	std::size_t lang_file::format_form(identifier id,
+	                                   std::string_view str,
+	                                   intmax_t sub,
+	                                   std::string_view const* args,
+	                                   std::size_t arg_count,
+	                                   char* buffer,
+	                                   std::size_t size) const noexcept {
+		if (str.empty()) return 0;
+
+		placeholders::writer out{buffer, size, str, args, arg_count};
+
+		if (auto const tmplt = formats.get(id)) {
+			auto const first = formats.segments + tmplt->offset;
+			auto const last = first + tmplt->length;
+
+			auto cur = first;
+			while (sub && cur != last) {
+				if (cur->length == segment_plural_break) --sub;
+				++cur;
+			}
+			if (sub) cur = first;  // singular, as in get_string
+
+			for (; cur != last && cur->length != segment_plural_break; ++cur) {
+				if (cur->length == segment_placeholder)
+					out.arg(cur->value);
+				else
+					out.literal(cur->value, cur->length);
+			}
+			return out.pos;
+		}
+
+		auto const form = plural_form(str, sub);
+		out.str = form;
+		if (formats.keys || !placeholders::scan(form, out)) {
+			// either known to have no placeholders, or not a valid template
+			out.pos = 0;
+			out.put(form);
+		}
+		return out.pos;
+	}
+
+	plurals::lexical const& lang_file::plural_rule() const {
 		if (!lex) {
 			auto entry = attrs.string(static_cast<identifier>(ATTR_PLURALS));
-			if (!entry.empty()) lex = plurals::decode(entry);
-			if (!lex) lex = plurals::decode("nplurals=1;plural=0");
-
-			if (!lex) return 0;
+			if (!entry.empty())
+				lex = plurals::decode(
+				    entry, attrs.string(static_cast<identifier>(ATTR_CULTURE)));
+			if (!lex) lex = plurals::intern("nplurals=1;plural=0");
 		}
 
-		return lex.eval(static_cast<intmax_t>(count));
+		return lex;
+	}
+
+	intmax_t lang_file::calc_substring(quantity count) const {
+		return plural_rule().eval(static_cast<intmax_t>(count));
+	}
+
+	void lang_file::calc_substrings(intmax_t const* counts,
+	                                uint8_t* forms,
+	                                std::size_t size) const {
+		plural_rule().eval_many(counts, forms, size);
 	}
 }  // namespace lngs
@@ -10,11 +10,25 @@ namespace lngs::plurals::nodes {
 		heap_only(const heap_only&) = delete;
 		heap_only& operator=(const heap_only&) = delete;
 		heap_only& operator=(heap_only&&) = delete;
+
+		static std::size_t bytes_of(
+		    std::unique_ptr<expr> const& arg) noexcept {
+			return arg ? arg->heap_bytes() : 0;
+		}
 	};
 
 	// symbols:
 	struct var : heap_only {
 		intmax_t eval(intmax_t n, bool&) const noexcept override { return n; }
+		void eval_many(intmax_t const* n,
+		               intmax_t* out,
+		               bool*,
+		               std::size_t size) const noexcept override {
+			std::copy(n, n + size, out);
+		}
+		std::size_t heap_bytes() const noexcept override {
+			return sizeof(*this);
+		}
 	};
 
 	class value : public heap_only {
@@ -24,7 +38,18 @@ namespace lngs::plurals::nodes {
 		value() = default;
 		value(int val) : m_val(val) {}
 
+		int get() const noexcept { return m_val; }
+
 		intmax_t eval(intmax_t, bool&) const noexcept override { return m_val; }
+		void eval_many(intmax_t const*,
+		               intmax_t* out,
+		               bool*,
+		               std::size_t size) const noexcept override {
+			std::fill(out, out + size, intmax_t{m_val});
+		}
+		std::size_t heap_bytes() const noexcept override {
+			return sizeof(*this);
+		}
 	};
 
 	// unary-op
@@ -42,6 +67,19 @@ namespace lngs::plurals::nodes {
 			if (failed) return 0;
 			return !op;
 		}
+
+		void eval_many(intmax_t const* n,
+		               intmax_t* out,
+		               bool* failed,
+		               std::size_t size) const noexcept override {
+			m_arg1->eval_many(n, out, failed, size);
+			for (std::size_t index = 0; index < size; ++index)
+				out[index] = !out[index];
+		}
+
+		std::size_t heap_bytes() const noexcept override {
+			return sizeof(*this) + bytes_of(m_arg1);
+		}
 	};
 
 	// binary-ops
@@ -55,6 +93,27 @@ namespace lngs::plurals::nodes {
 		explicit binary(std::unique_ptr<expr>&& arg1,
 		                std::unique_ptr<expr>&& arg2)
 		    : m_arg1(std::move(arg1)), m_arg2(std::move(arg2)) {}
+
+		std::size_t heap_bytes() const noexcept override {
+			return sizeof(*this) + bytes_of(m_arg1) +
+			       bytes_of(m_arg2);
+		}
+
+	protected:
+		// Both operands are always evaluated, so a failure of either one
+		// fails the count.
+		template <typename Op>
+		void apply_many(intmax_t const* n,
+		                intmax_t* out,
+		                bool* failed,
+		                std::size_t size,
+		                Op op) const noexcept {
+			intmax_t right[batch];
+			m_arg1->eval_many(n, out, failed, size);
+			m_arg2->eval_many(n, right, failed, size);
+			for (std::size_t index = 0; index < size; ++index)
+				out[index] = op(out[index], right[index]);
+		}
 	};
 
 	class multiply : public binary {
@@ -68,6 +127,16 @@ namespace lngs::plurals::nodes {
 			if (failed) return 0;
 			return left * right;
 		}
+
+		void eval_many(intmax_t const* n,
+		               intmax_t* out,
+		               bool* failed,
+		               std::size_t size) const noexcept override {
+			apply_many(n, out, failed, size,
+			           [](intmax_t left, intmax_t right) -> intmax_t {
+				           return left * right;
+			           });
+		}
 	};
 
 	class divide : public binary {
@@ -81,11 +150,40 @@ namespace lngs::plurals::nodes {
 			const auto left = m_arg1->eval(n, failed);
 			return left / right;
 		}
+
+		void eval_many(intmax_t const* n,
+		               intmax_t* out,
+		               bool* failed,
+		               std::size_t size) const noexcept override {
+			intmax_t right[batch];
+			m_arg2->eval_many(n, right, failed, size);
+			m_arg1->eval_many(n, out, failed, size);
+			for (std::size_t index = 0; index < size; ++index) {
+				auto const zero = right[index] == 0;
+				failed[index] = failed[index] | zero;
+				out[index] /= zero ? 1 : right[index];
+			}
+		}
 	};
 
 	class modulo : public binary {
+		// The right operand, if it is a number other than zero; n%10 and
+		// n%100 of the usual rules are then computed without a division.
+		intmax_t m_divisor{0};
+
+		template <intmax_t Divisor>
+		static void remainders(intmax_t* out, std::size_t size) noexcept {
+			for (std::size_t index = 0; index < size; ++index)
+				out[index] %= Divisor;
+		}
+
 	public:
-		using binary::binary;
+		explicit modulo(std::unique_ptr<expr>&& arg1,
+		                std::unique_ptr<expr>&& arg2)
+		    : binary(std::move(arg1), std::move(arg2)) {
+			if (auto const num = dynamic_cast<value const*>(m_arg2.get()))
+				m_divisor = num->get();
+		}
 
 		intmax_t eval(intmax_t n, bool& failed) const noexcept override {
 			const auto right = m_arg2->eval(n, failed);
@@ -94,6 +192,36 @@ namespace lngs::plurals::nodes {
 			const auto left = m_arg1->eval(n, failed);
 			return left % right;
 		}
+
+		void eval_many(intmax_t const* n,
+		               intmax_t* out,
+		               bool* failed,
+		               std::size_t size) const noexcept override {
+			switch (m_divisor) {
+				case 0:
+					break;
+				case 10:
+					m_arg1->eval_many(n, out, failed, size);
+					return remainders<10>(out, size);
+				case 100:
+					m_arg1->eval_many(n, out, failed, size);
+					return remainders<100>(out, size);
+				default:
+					m_arg1->eval_many(n, out, failed, size);
+					for (std::size_t index = 0; index < size; ++index)
+						out[index] %= m_divisor;
+					return;
+			}
+
+			intmax_t right[batch];
+			m_arg2->eval_many(n, right, failed, size);
+			m_arg1->eval_many(n, out, failed, size);
+			for (std::size_t index = 0; index < size; ++index) {
+				auto const zero = right[index] == 0;
+				failed[index] = failed[index] | zero;
+				out[index] %= zero ? 1 : right[index];
+			}
+		}
 	};
 
 	class plus : public binary {
@@ -107,6 +235,16 @@ namespace lngs::plurals::nodes {
 			if (failed) return 0;
 			return left + right;
 		}
+
+		void eval_many(intmax_t const* n,
+		               intmax_t* out,
+		               bool* failed,
+		               std::size_t size) const noexcept override {
+			apply_many(n, out, failed, size,
+			           [](intmax_t left, intmax_t right) -> intmax_t {
+				           return left + right;
+			           });
+		}
 	};
 
 	class minus : public binary {
@@ -120,6 +258,16 @@ namespace lngs::plurals::nodes {
 			if (failed) return 0;
 			return left - right;
 		}
+
+		void eval_many(intmax_t const* n,
+		               intmax_t* out,
+		               bool* failed,
+		               std::size_t size) const noexcept override {
+			apply_many(n, out, failed, size,
+			           [](intmax_t left, intmax_t right) -> intmax_t {
+				           return left - right;
+			           });
+		}
 	};
 
 	class less_than : public binary {
@@ -133,6 +281,16 @@ namespace lngs::plurals::nodes {
 			if (failed) return 0;
 			return left < right;
 		}
+
+		void eval_many(intmax_t const* n,
+		               intmax_t* out,
+		               bool* failed,
+		               std::size_t size) const noexcept override {
+			apply_many(n, out, failed, size,
+			           [](intmax_t left, intmax_t right) -> intmax_t {
+				           return left < right;
+			           });
+		}
 	};
 
 	class greater_than : public binary {
@@ -146,6 +304,16 @@ namespace lngs::plurals::nodes {
 			if (failed) return 0;
 			return left > right;
 		}
+
+		void eval_many(intmax_t const* n,
+		               intmax_t* out,
+		               bool* failed,
+		               std::size_t size) const noexcept override {
+			apply_many(n, out, failed, size,
+			           [](intmax_t left, intmax_t right) -> intmax_t {
+				           return left > right;
+			           });
+		}
 	};
 
 	class less_than_or_equal : public binary {
@@ -159,6 +327,16 @@ namespace lngs::plurals::nodes {
 			if (failed) return 0;
 			return left <= right;
 		}
+
+		void eval_many(intmax_t const* n,
+		               intmax_t* out,
+		               bool* failed,
+		               std::size_t size) const noexcept override {
+			apply_many(n, out, failed, size,
+			           [](intmax_t left, intmax_t right) -> intmax_t {
+				           return left <= right;
+			           });
+		}
 	};
 
 	class greater_than_or_equal : public binary {
@@ -172,6 +350,16 @@ namespace lngs::plurals::nodes {
 			if (failed) return 0;
 			return left >= right;
 		}
+
+		void eval_many(intmax_t const* n,
+		               intmax_t* out,
+		               bool* failed,
+		               std::size_t size) const noexcept override {
+			apply_many(n, out, failed, size,
+			           [](intmax_t left, intmax_t right) -> intmax_t {
+				           return left >= right;
+			           });
+		}
 	};
 
 	class equal : public binary {
@@ -185,6 +373,16 @@ namespace lngs::plurals::nodes {
 			if (failed) return 0;
 			return left == right;
 		}
+
+		void eval_many(intmax_t const* n,
+		               intmax_t* out,
+		               bool* failed,
+		               std::size_t size) const noexcept override {
+			apply_many(n, out, failed, size,
+			           [](intmax_t left, intmax_t right) -> intmax_t {
+				           return left == right;
+			           });
+		}
 	};
 
 	class not_equal : public binary {
@@ -198,6 +396,16 @@ namespace lngs::plurals::nodes {
 			if (failed) return 0;
 			return left != right;
 		}
+
+		void eval_many(intmax_t const* n,
+		               intmax_t* out,
+		               bool* failed,
+		               std::size_t size) const noexcept override {
+			apply_many(n, out, failed, size,
+			           [](intmax_t left, intmax_t right) -> intmax_t {
+				           return left != right;
+			           });
+		}
 	};
 
 	class logical_and : public binary {
@@ -211,6 +419,23 @@ namespace lngs::plurals::nodes {
 			if (failed) return 0;
 			return left && right;
 		}
+
+		// The right operand is only evaluated for counts, for which the
+		// left one is true, so only its failures for them count.
+		void eval_many(intmax_t const* n,
+		               intmax_t* out,
+		               bool* failed,
+		               std::size_t size) const noexcept override {
+			intmax_t right[batch];
+			bool right_failed[batch]{};
+			m_arg1->eval_many(n, out, failed, size);
+			m_arg2->eval_many(n, right, right_failed, size);
+			for (std::size_t index = 0; index < size; ++index) {
+				auto const left = out[index] != 0;
+				failed[index] = failed[index] | (left & right_failed[index]);
+				out[index] = left & (right[index] != 0);
+			}
+		}
 	};
 
 	class logical_or : public binary {
@@ -225,6 +450,21 @@ namespace lngs::plurals::nodes {
 			if (failed) return 0;
 			return left || right;
 		}
+
+		void eval_many(intmax_t const* n,
+		               intmax_t* out,
+		               bool* failed,
+		               std::size_t size) const noexcept override {
+			intmax_t right[batch];
+			bool right_failed[batch]{};
+			m_arg1->eval_many(n, out, failed, size);
+			m_arg2->eval_many(n, right, right_failed, size);
+			for (std::size_t index = 0; index < size; ++index) {
+				auto const left = out[index] != 0;
+				failed[index] = failed[index] | (!left & right_failed[index]);
+				out[index] = left | (right[index] != 0);
+			}
+		}
 	};
 
 	// ternary-op
@@ -250,5 +490,33 @@ namespace lngs::plurals::nodes {
 			if (failed) return 0;
 			return right;
 		}
+
+		// Both branches are evaluated for every count and the results are
+		// picked afterwards, with the failures of the picked branch only.
+		void eval_many(intmax_t const* n,
+		               intmax_t* out,
+		               bool* failed,
+		               std::size_t size) const noexcept override {
+			intmax_t cond[batch];
+			intmax_t other[batch];
+			bool then_failed[batch]{};
+			bool else_failed[batch]{};
+			m_arg1->eval_many(n, cond, failed, size);
+			m_arg2->eval_many(n, out, then_failed, size);
+			m_arg3->eval_many(n, other, else_failed, size);
+			for (std::size_t index = 0; index < size; ++index) {
+				auto const pick = cond[index] != 0;
+				auto const branch_failed =
+				    pick ? then_failed[index] : else_failed[index];
+				failed[index] = failed[index] | branch_failed;
+				out[index] = pick ? out[index] : other[index];
+			}
+		}
+
+		std::size_t heap_bytes() const noexcept override {
+			return sizeof(*this) + bytes_of(m_arg1) +
+			       bytes_of(m_arg2) +
+			       bytes_of(m_arg3);
+		}
 	};
 }  // namespace lngs::plurals::nodes
@@ -1,8 +1,14 @@
 // Copyright (c) 2015 midnightBITS
 // This code is licensed under MIT license (see LICENSE for details)
 
+#include <algorithm>
 #include <cstdlib>
+#include <iterator>
 #include <lngs/plurals.hpp>
+#include <mutex>
+#include <string>
+#include <unordered_map>
+#include <vector>
 #include "expr_parser.hpp"
 #include "node.hpp"
 #include "str.hpp"
@@ -25,7 +31,139 @@ namespace lngs::plurals {
 		return out;
 	}
 
+	lexical decode(std::string_view entry, std::string_view culture) {
+		if (auto const found = find_native(culture, entry); found.rule) {
+			lexical out;
+			out.nplurals = found.nplurals;
+			out.native = found.rule;
+			return out;
+		}
+		return intern(entry);
+	}
+
+	namespace {
+		bool space(char c) noexcept {
+			return c == ' ' || c == '\t' || c == '\r' || c == '\n';
+		}
+
+		bool same_forms(std::string_view lhs, std::string_view rhs) noexcept {
+			auto left = lhs.begin();
+			auto right = rhs.begin();
+			while (true) {
+				left = std::find_if_not(left, lhs.end(), space);
+				right = std::find_if_not(right, rhs.end(), space);
+				if (left == lhs.end() || right == rhs.end()) break;
+				if (*left != *right) return false;
+				++left;
+				++right;
+			}
+			return left == lhs.end() && right == rhs.end();
+		}
+
+		struct interned {
+			std::mutex lock{};
+			std::unordered_map<std::string, lexical> rules{};
+
+			static interned& get() {
+				static interned instance{};
+				return instance;
+			}
+		};
+
+		struct registry {
+			std::mutex lock{};
+			std::vector<native> entries{};
+
+			static registry& get() {
+				static registry instance{};
+				return instance;
+			}
+		};
+	}  // namespace
+
+	lexical intern(std::string_view entry) {
+		std::string key{};
+		key.reserve(entry.size());
+		std::remove_copy_if(entry.begin(), entry.end(), std::back_inserter(key),
+		                    space);
+
+		auto& self = interned::get();
+		{
+			std::lock_guard guard{self.lock};
+			auto it = self.rules.find(key);
+			if (it != self.rules.end()) return it->second;
+		}
+
+		// parsed outside of the lock; if another thread was faster, its
+		// tree is the one kept and shared
+		auto rule = decode(entry);
+		std::lock_guard guard{self.lock};
+		return self.rules.try_emplace(std::move(key), std::move(rule))
+		    .first->second;
+	}
+
+	void register_native(native const& entry) {
+		auto& self = registry::get();
+		std::lock_guard guard{self.lock};
+		for (auto& known : self.entries) {
+			if (known.culture == entry.culture &&
+			    same_forms(known.forms, entry.forms)) {
+				known = entry;
+				return;
+			}
+		}
+		self.entries.push_back(entry);
+	}
+
+	native find_native(std::string_view culture,
+	                   std::string_view forms) noexcept {
+		if (culture.empty()) return {};
+		auto& self = registry::get();
+		std::lock_guard guard{self.lock};
+		for (auto const& known : self.entries) {
+			if (known.culture == culture && same_forms(known.forms, forms))
+				return known;
+		}
+		return {};
+	}
+
+	namespace {
+		inline uint8_t form_of(intmax_t value) noexcept {
+			return value < 0 || value > 255 ? uint8_t{255}
+			                                : static_cast<uint8_t>(value);
+		}
+	}  // namespace
+
+	void lexical::eval_many(intmax_t const* counts,
+	                        uint8_t* forms,
+	                        std::size_t size) const noexcept {
+		if (native) {
+			for (std::size_t index = 0; index < size; ++index)
+				forms[index] = form_of(native(counts[index]));
+			return;
+		}
+
+		if (!plural) {
+			std::fill(forms, forms + size, uint8_t{0});
+			return;
+		}
+
+		intmax_t values[expr::batch];
+		bool failed[expr::batch];
+		while (size) {
+			auto const chunk = std::min(size, expr::batch);
+			std::fill(failed, failed + chunk, false);
+			plural->eval_many(counts, values, failed, chunk);
+			for (std::size_t index = 0; index < chunk; ++index)
+				forms[index] = failed[index] ? 0 : form_of(values[index]);
+			counts += chunk;
+			forms += chunk;
+			size -= chunk;
+		}
+	}
+
 	intmax_t lexical::eval(intmax_t n) const noexcept {
+		if (native) return native(n);
 		if (!plural) return 0;
 		bool failed = false;
 		const auto ret = plural->eval(n, failed);
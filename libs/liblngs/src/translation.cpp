@@ -6,6 +6,15 @@
 #include <lngs/translation.hpp>
 #include <memory>
 
+#if defined WIN32 || defined _WIN32
+#include <windows.h>
+#else
+#include <fcntl.h>
+#include <sys/mman.h>
+#include <sys/stat.h>
+#include <unistd.h>
+#endif
+
 namespace lngs {
 	namespace {
 		struct fcloser {
@@ -76,28 +85,141 @@ namespace lngs {
 		return block;
 	}
 
+	mapped_file::~mapped_file() {
+		if (!contents) return;
+#if defined WIN32 || defined _WIN32
+		::UnmapViewOfFile(contents);
+#else
+		::munmap(const_cast<std::byte*>(contents), m_length);
+#endif
+	}
+
+	/* static */
+	mapped_file mapped_file::open(const std::filesystem::path& path) noexcept {
+		mapped_file result;
+		auto native = path;
+		native.make_preferred();
+
+#if defined WIN32 || defined _WIN32
+		auto file = ::CreateFileW(native.native().c_str(), GENERIC_READ,
+		                          FILE_SHARE_READ, nullptr, OPEN_EXISTING,
+		                          FILE_ATTRIBUTE_NORMAL, nullptr);
+		if (file == INVALID_HANDLE_VALUE) return result;
+
+		LARGE_INTEGER file_size{};
+		if (!::GetFileSizeEx(file, &file_size) || !file_size.QuadPart) {
+			::CloseHandle(file);
+			return result;
+		}
+
+		auto mapping =
+		    ::CreateFileMappingW(file, nullptr, PAGE_READONLY, 0, 0, nullptr);
+		::CloseHandle(file);
+		if (!mapping) return result;
+
+		auto view = ::MapViewOfFile(mapping, FILE_MAP_READ, 0, 0, 0);
+		::CloseHandle(mapping);
+		if (!view) return result;
+
+		result.contents = static_cast<std::byte const*>(view);
+		result.size = static_cast<uintmax_t>(file_size.QuadPart);
+		result.m_length = static_cast<std::size_t>(file_size.QuadPart);
+#else
+		auto fd = ::open(native.c_str(), O_RDONLY | O_CLOEXEC);
+		if (fd < 0) return result;
+
+		struct stat st {};
+		if (::fstat(fd, &st) || st.st_size <= 0) {
+			::close(fd);
+			return result;
+		}
+
+		auto const length = static_cast<std::size_t>(st.st_size);
+		auto view = ::mmap(nullptr, length, PROT_READ, MAP_PRIVATE, fd, 0);
+		::close(fd);
+		if (view == MAP_FAILED) return result;
+
+		result.contents = static_cast<std::byte const*>(view);
+		result.size = length;
+		result.m_length = length;
+#endif
+
+		return result;
+	}
+
+	/* static */
+	std::size_t duration_histogram::bucket_of(
+	    std::chrono::nanoseconds duration) noexcept {
+		auto micros = duration.count() / 1000;
+		std::size_t bucket = 0;
+		while (micros > 0 && bucket < bucket_count - 1) {
+			micros >>= 1;
+			++bucket;
+		}
+		return bucket;
+	}
+
+	void duration_histogram::add(std::chrono::nanoseconds duration) noexcept {
+		if (m_count >= window) {
+			m_count = 0;
+			for (auto& bucket : m_buckets) {
+				bucket /= 2;
+				m_count += bucket;
+			}
+		}
+		++m_buckets[bucket_of(duration)];
+		++m_count;
+		m_last = duration;
+		if (m_max < duration) m_max = duration;
+	}
+
 	bool translation::open(const std::string& lng, SerialNumber serial) {
+		using clock = std::chrono::steady_clock;
+
 		assert(m_path_mgr);
 		m_path = m_path_mgr->expand(lng);
 		m_mtime = mtime();
 
 		m_file.close();
 		m_path.make_preferred();
+
+		// without any listeners, there is no one to copy the path for
+		update_event event{};
+		if (!m_updatelisteners.empty()) {
+			event.path = m_path;
+			event.lang = lng;
+		}
+
+		auto const start = clock::now();
 		m_data = open_file(m_path);
+		auto const read = clock::now();
+		event.read_time = read - start;
+		event.bytes = m_data.size;
+		m_metrics.read.add(event.read_time);
+
+		auto valid = false;
+		if (m_data.size) {
+			valid = m_file.open(m_data);
+			event.validate_time = clock::now() - read;
+			m_metrics.validate.add(event.validate_time);
+		}
 
 		auto const check_serial = serial != SerialNumber::UseAny;
 		auto const serial_to_check = static_cast<unsigned>(serial);
-		if (!m_file.open(m_data) ||
-		    (check_serial && m_file.get_serial() != serial_to_check)) {
+		event.serial_mismatch =
+		    valid && check_serial && m_file.get_serial() != serial_to_check;
+		if (!valid || event.serial_mismatch) {
 			m_file.close();
 			m_data = memory_block{};
 			m_mtime = decltype(m_mtime){};
 
-			onupdate();
+			onupdate(event);
 			return false;
 		}
 
-		onupdate();
+		event.strings = m_file.size();
+		event.ok = true;
+		onupdate(event);
 		return true;
 	}
 
@@ -110,6 +232,28 @@ namespace lngs {
 		return m_file.get_string(id, count);
 	}
 
+	std::string_view translation::get_string(identifier id,
+	                                         slot pos) const noexcept {
+		return m_file.get_string(id, pos);
+	}
+
+	std::string_view translation::get_string(identifier id,
+	                                         slot pos,
+	                                         quantity count) const noexcept {
+		return m_file.get_string(id, pos, count);
+	}
+
+	bool translation::get_strings(identifier id,
+	                              intmax_t const* counts,
+	                              std::string_view* out,
+	                              std::size_t size) const noexcept {
+		return m_file.get_strings(id, counts, out, size);
+	}
+
+	intmax_t translation::calc_substring(quantity count) const {
+		return m_file.calc_substring(count);
+	}
+
 	std::string_view translation::get_attr(uint32_t id) const noexcept {
 		return m_file.get_attr(id);
 	}
@@ -122,6 +266,29 @@ namespace lngs {
 		return m_file.find_key(id);
 	}
 
+	std::size_t translation::format(identifier id,
+	                                std::string_view const* args,
+	                                std::size_t arg_count,
+	                                char* buffer,
+	                                std::size_t size) const noexcept {
+		return m_file.format(id, args, arg_count, buffer, size);
+	}
+
+	std::size_t translation::format(identifier id,
+	                                quantity count,
+	                                std::string_view const* args,
+	                                std::size_t arg_count,
+	                                char* buffer,
+	                                std::size_t size) const noexcept {
+		return m_file.format(id, count, args, arg_count, buffer, size);
+	}
+
+	memory_footprint translation::memory_usage() const noexcept {
+		auto result = m_file.memory_usage();
+		result.heap += m_data.block.capacity();
+		return result;
+	}
+
 	std::vector<culture> translation::known() const {
 		assert(m_path_mgr);
 		auto files = m_path_mgr->known();
@@ -152,10 +319,15 @@ namespace lngs {
 	}
 
 	uint32_t translation::add_onupdate(const std::function<void()>& fn) {
+		if (!fn) return 0;
+		return add_listener([fn](update_event const&) { fn(); });
+	}
+
+	uint32_t translation::add_listener(listener fn) {
 		if (!fn) return 0;
 		++m_nextupdate;
 		if (!m_nextupdate) ++m_nextupdate;
-		m_updatelisteners[m_nextupdate] = fn;
+		m_updatelisteners[m_nextupdate] = std::move(fn);
 		return m_nextupdate;
 	}
 
@@ -164,9 +336,9 @@ namespace lngs {
 		if (it != m_updatelisteners.end()) m_updatelisteners.erase(it);
 	}
 
-	void translation::onupdate() {
+	void translation::onupdate(update_event const& event) {
 		auto copy = m_updatelisteners;
 		for (auto& pair : copy)
-			pair.second();
+			pair.second(event);
 	}
 }  // namespace lngs
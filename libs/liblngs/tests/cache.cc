@@ -0,0 +1,113 @@
+#include <gtest/gtest.h>
+#include <lngs/lngs_cache.hpp>
+#include "lang_file_helpers.h"
+
+extern std::filesystem::path TESTING_data_path;
+
+namespace lngs::testing {
+	using namespace ::std::literals;
+
+	enum class cached_lng { YES = 1000, NO = 1001, MAYBE = 1002 };
+	enum class cached_counted { FILES = 1 };
+
+	struct cached_resource {
+		static std::vector<std::byte> const& bytes() {
+			static std::vector<std::byte> const contents = [] {
+				std::vector<std::byte> out;
+
+				struct stream : diags::outstream {
+					std::vector<std::byte>& contents;
+
+					stream(std::vector<std::byte>& contents)
+					    : contents{contents} {}
+					std::size_t write(const void* data,
+					                  std::size_t length) noexcept final {
+						auto b = static_cast<const std::byte*>(data);
+						auto e = b + length;
+						auto size = contents.size();
+						contents.insert(end(contents), b, e);
+						return contents.size() - size;
+					}
+				} output{out};
+
+				app::file file;
+				file.attrs.emplace_back(ATTR_PLURALS,
+				                        "nplurals=2; plural=(n != 1);");
+				file.strings.emplace_back(1, "{0} file\0{0} files"s);
+				file.write(output);
+				return out;
+			}();
+			return contents;
+		}
+
+		static const char* data() {
+			return reinterpret_cast<const char*>(bytes().data());
+		}
+		static std::size_t size() { return bytes().size(); }
+	};
+
+	using file_strings = SingularStrings<cached_lng, storage::FileBased>;
+	using builtin_strings =
+	    PluralOnlyStrings<cached_counted, storage::Builtin<cached_resource>>;
+
+	static_assert(cache::has_onupdate_v<file_strings>);
+	static_assert(!cache::has_onupdate_v<builtin_strings>);
+
+	TEST(cache, plurals) {
+		builtin_strings tr;
+		ASSERT_TRUE(tr.init_builtin());
+
+		FormatCache<builtin_strings> cache{tr};
+		EXPECT_EQ("1 file"sv, cache.format(cached_counted::FILES, 1, {"1"}));
+		EXPECT_EQ("5 files"sv, cache.format(cached_counted::FILES, 5, {"5"}));
+		EXPECT_EQ(2u, cache.size());
+
+		EXPECT_EQ("5 files"sv, cache.format(cached_counted::FILES, 5, {"5"}));
+		EXPECT_EQ(2u, cache.size());
+
+		// another count, but the same plural form
+		EXPECT_EQ(1, tr.plural_index(cached_counted::FILES, 7));
+		EXPECT_EQ("5 files"sv, cache.format(cached_counted::FILES, 7, {"5"}));
+		EXPECT_EQ(2u, cache.size());
+
+		// same arguments, but another plural form
+		EXPECT_EQ(0, tr.plural_index(cached_counted::FILES, 1));
+		EXPECT_EQ("5 file"sv, cache.format(cached_counted::FILES, 1, {"5"}));
+		EXPECT_EQ(3u, cache.size());
+
+		cache.clear();
+		EXPECT_EQ(0u, cache.size());
+	}
+
+	TEST(cache, bounded) {
+		builtin_strings tr;
+		ASSERT_TRUE(tr.init_builtin());
+
+		FormatCache<builtin_strings, 2, 4> cache{tr};
+		for (int count = 0; count < 100; ++count) {
+			auto const arg = std::to_string(count);
+			auto const expected = arg + (count == 1 ? " file" : " files");
+			EXPECT_EQ(expected, cache.format(cached_counted::FILES, count,
+			                                 {std::string_view{arg}}));
+			EXPECT_LE(cache.size(), cache.capacity);
+		}
+		EXPECT_EQ(8u, cache.capacity);
+	}
+
+	TEST(cache, reload) {
+		file_strings tr;
+		tr.path_manager<manager::ExtensionPath>(
+		    TESTING_data_path / "testset1.ext", "pkg1");
+		ASSERT_TRUE(tr.open("foo", SerialNumber::UseAny));
+
+		FormatCache<file_strings> cache{tr};
+		EXPECT_EQ("foo:yes"sv, cache.format(cached_lng::YES, {}));
+		EXPECT_EQ("foo:no"sv, cache.format(cached_lng::NO, {}));
+		EXPECT_EQ(2u, cache.size());
+
+		ASSERT_TRUE(tr.open("bar", SerialNumber::UseAny));
+		EXPECT_EQ(0u, cache.size());
+		EXPECT_EQ("bar:yes"sv, cache.format(cached_lng::YES, {}));
+		EXPECT_EQ(1u, cache.size());
+	}
+}  // namespace lngs::testing
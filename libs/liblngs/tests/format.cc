@@ -0,0 +1,186 @@
+#include <gtest/gtest.h>
+#include "lang_file_helpers.h"
+
+namespace lngs::testing {
+	using namespace ::std::literals;
+	using ::testing::TestWithParam;
+	using ::testing::ValuesIn;
+
+	struct format_test {
+		int id;
+		std::string value;
+		std::vector<std::string_view> args{};
+		std::string expected{};
+		intmax_t count{-1};
+	};
+
+	struct format_env {
+		bool with_formats{false};
+		format_test test{};
+	};
+
+	std::vector<std::byte> build_formats(std::vector<format_test> const& defs,
+	                                     bool with_formats) {
+		std::vector<std::byte> out;
+
+		struct stream : diags::outstream {
+			std::vector<std::byte>& contents;
+
+			stream(std::vector<std::byte>& contents) : contents{contents} {}
+			std::size_t write(const void* data,
+			                  std::size_t length) noexcept final {
+				auto b = static_cast<const std::byte*>(data);
+				auto e = b + length;
+				auto size = contents.size();
+				contents.insert(end(contents), b, e);
+				return contents.size() - size;
+			}
+		} output{out};
+
+		app::file file;
+		file.attrs.emplace_back(ATTR_PLURALS, "nplurals=2; plural=(n != 1);");
+		for (auto const& def : defs)
+			file.strings.emplace_back(def.id, def.value);
+		if (with_formats) file.formats = app::format_templates(file.strings);
+
+		file.write(output);
+		return out;
+	}
+
+	struct format_file : TestWithParam<format_env> {};
+
+	TEST_P(format_file, expand) {
+		auto const& [with_formats, test] = GetParam();
+
+		auto bytes = build_formats({test}, with_formats);
+
+		lang_file file;
+		ASSERT_TRUE(file.open({bytes.data(), bytes.size()}));
+
+		auto const id = static_cast<lang_file::identifier>(test.id);
+		char buffer[256];
+		auto const length =
+		    test.count < 0
+		        ? file.format(id, test.args.data(), test.args.size(), buffer,
+		                      sizeof(buffer))
+		        : file.format(id, static_cast<lang_file::quantity>(test.count),
+		                      test.args.data(), test.args.size(), buffer,
+		                      sizeof(buffer));
+		ASSERT_LE(length, sizeof(buffer));
+		EXPECT_EQ(test.expected, std::string_view(buffer, length));
+	}
+
+	TEST_P(format_file, truncated) {
+		auto const& [with_formats, test] = GetParam();
+
+		auto bytes = build_formats({test}, with_formats);
+
+		lang_file file;
+		ASSERT_TRUE(file.open({bytes.data(), bytes.size()}));
+
+		auto const id = static_cast<lang_file::identifier>(test.id);
+		char buffer[4];
+		auto const length =
+		    test.count < 0
+		        ? file.format(id, test.args.data(), test.args.size(), buffer,
+		                      sizeof(buffer))
+		        : file.format(id, static_cast<lang_file::quantity>(test.count),
+		                      test.args.data(), test.args.size(), buffer,
+		                      sizeof(buffer));
+		EXPECT_EQ(test.expected.size(), length);
+		auto const prefix = std::min(length, sizeof(buffer));
+		EXPECT_EQ(std::string_view(test.expected).substr(0, prefix),
+		          std::string_view(buffer, prefix));
+	}
+
+	TEST(format, missing) {
+		auto bytes = build_formats({{1, "value"}}, true);
+
+		lang_file file;
+		ASSERT_TRUE(file.open({bytes.data(), bytes.size()}));
+
+		char buffer[16];
+		EXPECT_EQ(0u, file.format(static_cast<lang_file::identifier>(2),
+		                          nullptr, 0, buffer, sizeof(buffer)));
+		EXPECT_EQ(0u, file.format(static_cast<lang_file::identifier>(2),
+		                          static_cast<lang_file::quantity>(5), nullptr,
+		                          0, buffer, sizeof(buffer)));
+	}
+
+	TEST(format, templates) {
+		app::file file;
+		file.strings.emplace_back(1, "plain");
+		file.strings.emplace_back(2, "{0} and {1}");
+		file.strings.emplace_back(3, "{{escaped}}");
+		file.strings.emplace_back(4, "{unnamed");
+		file.strings.emplace_back(5, "{} file\0{} files"s);
+		file.strings.emplace_back(6, "{} file\0{bad}"s);
+		file.strings.emplace_back(7, "{bad} file\0{bad}"s);
+
+		auto const templates = app::format_templates(file.strings);
+		ASSERT_EQ(4u, templates.size());
+		EXPECT_EQ(2u, templates[0].id);
+		EXPECT_EQ(3u, templates[1].id);
+		EXPECT_EQ(5u, templates[2].id);
+		EXPECT_EQ(6u, templates[3].id);
+
+		std::vector<format_segment> expected{
+		    {0, segment_placeholder}, {2, 5}, {0, segment_plural_break},
+		    {0, segment_placeholder}, {10, 6},
+		};
+		ASSERT_EQ(expected.size(), templates[2].segments.size());
+		for (size_t index = 0; index < expected.size(); ++index) {
+			EXPECT_EQ(expected[index].value,
+			          templates[2].segments[index].value);
+			EXPECT_EQ(expected[index].length,
+			          templates[2].segments[index].length);
+		}
+
+		// the malformed form is kept whole
+		expected = {
+		    {0, segment_placeholder},
+		    {2, 5},
+		    {0, segment_plural_break},
+		    {8, 5},
+		};
+		ASSERT_EQ(expected.size(), templates[3].segments.size());
+		for (size_t index = 0; index < expected.size(); ++index) {
+			EXPECT_EQ(expected[index].value,
+			          templates[3].segments[index].value);
+			EXPECT_EQ(expected[index].length,
+			          templates[3].segments[index].length);
+		}
+	}
+
+	static format_test const tests[] = {
+	    {1, "plain", {"ignored"}, "plain"},
+	    {2, "argument {0}: value {1} is not recognized", {"-x", "zz"},
+	     "argument -x: value zz is not recognized"},
+	    {3, "{1} before {0}", {"A", "B"}, "B before A"},
+	    {4, "{} and {}", {"A", "B"}, "A and B"},
+	    {5, "{{literal}} {0:>5}", {"A"}, "{literal} A"},
+	    {6, "missing {0} and {1}", {"A"}, "missing A and "},
+	    {7, "invalid {name}", {"A"}, "invalid {name}"},
+	    {8, "unbalanced }", {}, "unbalanced }"},
+	    {9, "{} file\0{} files"s, {"1"}, "1 file", 1},
+	    {10, "{} file\0{} files"s, {"5"}, "5 files", 5},
+	    {11, "{} file\0{} files"s, {"5"}, "5 file"},
+	    {12, "plain\0plains"s, {}, "plains", 5},
+	    {13, "{{single}} form", {}, "{single} form", 5},
+	    {14, "{} file\0{bad} {{files}}"s, {"1"}, "1 file", 1},
+	    {15, "{} file\0{bad} {{files}}"s, {"5"}, "{bad} {{files}}", 5},
+	    {16, "{bad} {{file}}\0{} files"s, {"5"}, "5 files", 5},
+	};
+
+	std::vector<format_env> environment() {
+		std::vector<format_env> out;
+		out.reserve(2 * std::size(tests));
+		for (auto with_formats : {false, true}) {
+			for (auto const& test : tests)
+				out.push_back({with_formats, test});
+		}
+		return out;
+	}
+
+	INSTANTIATE_TEST_SUITE_P(tests, format_file, ValuesIn(environment()));
+}  // namespace lngs::testing
@@ -1,5 +1,6 @@
 #include <gtest/gtest.h>
 #include <../src/str.hpp>
+#include <lngs/internals/commands.hpp>
 #include "lang_file_helpers.h"
 
 namespace lngs::testing {
@@ -7,25 +8,24 @@ namespace lngs::testing {
 	using ::testing::TestWithParam;
 	using ::testing::ValuesIn;
 
+	struct byte_stream : diags::outstream {
+		std::vector<std::byte>& contents;
+
+		byte_stream(std::vector<std::byte>& contents) : contents{contents} {}
+		std::size_t write(const void* data, std::size_t length) noexcept final {
+			auto b = static_cast<const std::byte*>(data);
+			auto e = b + length;
+			auto size = contents.size();
+			contents.insert(end(contents), b, e);
+			return contents.size() - size;
+		}
+	};
+
 	std::vector<std::byte> build_bytes(const app::idl_strings& defs,
 	                                   const helper::attrs_t& attrs,
 	                                   bool with_keys) {
 		std::vector<std::byte> out;
-
-		struct stream : diags::outstream {
-			std::vector<std::byte>& contents;
-
-			stream(std::vector<std::byte>& contents) : contents{contents} {}
-			std::size_t write(const void* data,
-			                  std::size_t length) noexcept final {
-				auto b = static_cast<const std::byte*>(data);
-				auto e = b + length;
-				auto size = contents.size();
-				contents.insert(end(contents), b, e);
-				return contents.size() - size;
-			}
-		} output{out};
-
+		byte_stream output{out};
 		helper::build_strings(output, defs, attrs, with_keys);
 		return out;
 	}
@@ -176,6 +176,40 @@ namespace lngs::testing {
 		}
 	}
 
+	TEST_P(lang_file_base, many) {
+		auto [defs, attrs, with_keys] = GetParam();
+
+		auto bytes = build_bytes(defs, attrs, with_keys);
+
+		lang_file file;
+		auto result = file.open({bytes.data(), bytes.size()});
+		EXPECT_TRUE(result);
+
+		std::vector<intmax_t> counts;
+		for (intmax_t count = -100; count < 100; ++count)
+			counts.push_back(count);
+		std::vector<std::string_view> actual(counts.size());
+
+		for (auto const& str : defs.strings) {
+			auto const id = static_cast<lang_file::identifier>(str.id);
+			EXPECT_TRUE(file.get_strings(id, counts.data(), actual.data(),
+			                             counts.size()));
+			for (std::size_t index = 0; index < counts.size(); ++index) {
+				auto const count =
+				    static_cast<lang_file::quantity>(counts[index]);
+				EXPECT_EQ(file.get_string(id, count), actual[index])
+				    << "Current: " << counts[index];
+			}
+		}
+
+		static constexpr const auto max_id = static_cast<lang_file::identifier>(
+		    std::numeric_limits<
+		        std::underlying_type_t<lang_file::identifier>>::max());
+		EXPECT_FALSE(file.get_strings(max_id, counts.data(), actual.data(),
+		                              counts.size()));
+		EXPECT_EQ(""sv, actual.front());
+	}
+
 	using helper::builder, helper::str;
 
 	static const auto stringz =
@@ -204,4 +238,40 @@ namespace lngs::testing {
 	};
 
 	INSTANTIATE_TEST_SUITE_P(files, lang_file_base, ValuesIn(files));
+
+	TEST(file, dense) {
+		helper::builder build{};
+		auto const defs = build.make(helper::str(1001, "ONE", "one"),
+		                             helper::str(1005, "FIVE", "five"),
+		                             helper::str(1002, "TWO", "two"));
+
+		app::file data{};
+		data.strings.emplace_back(1005, "pięć");
+		data.strings.emplace_back(1001, "jeden");
+		app::make::make_dense(data, defs);
+		ASSERT_EQ(3u, data.dense);
+
+		std::vector<std::byte> bytes;
+		byte_stream output{bytes};
+		data.write(output);
+
+		lang_file file;
+		ASSERT_TRUE(file.open({bytes.data(), bytes.size()}));
+		EXPECT_EQ(3u, file.dense_size());
+
+		using id = lang_file::identifier;
+		using slot = lang_file::slot;
+		EXPECT_EQ("jeden"sv, file.get_string(id{1001}, slot{0}));
+		EXPECT_EQ(""sv, file.get_string(id{1002}, slot{1}));
+		EXPECT_EQ("pięć"sv, file.get_string(id{1005}, slot{2}));
+		// a wrong slot costs a search, but still finds the string
+		EXPECT_EQ("pięć"sv, file.get_string(id{1005}, slot{0}));
+		EXPECT_EQ("pięć"sv, file.get_string(id{1005}, slot{7}));
+		EXPECT_EQ(""sv, file.get_string(id{1003}, slot{1}));
+
+		data.dense = 4;
+		bytes.clear();
+		data.write(output);
+		EXPECT_FALSE(file.open({bytes.data(), bytes.size()}));
+	}
 }  // namespace lngs::testing
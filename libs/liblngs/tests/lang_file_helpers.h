@@ -33,6 +33,12 @@ namespace lngs::testing::helper {
 		}
 	};
 
+	// Keeps the text of the definitions made below for the whole test run.
+	inline lngs::app::idl_arena& test_arena() {
+		static lngs::app::idl_arena arena{};
+		return arena;
+	}
+
 	struct builder {
 		uint32_t serial{0};
 		template <typename... Strings>
@@ -48,9 +54,10 @@ namespace lngs::testing::helper {
 	};
 
 	inline lngs::app::idl_string str(int id,
-	                                 std::string key,
-	                                 std::string value) {
-		return {std::move(key), std::move(value), {}, {}, id, id};
+	                                 std::string_view key,
+	                                 std::string_view value) {
+		auto& arena = test_arena();
+		return {arena.store(key), arena.store(value), {}, {}, id, id};
 	}
 
 	inline void build_strings(diags::outstream& dst,
@@ -65,8 +72,9 @@ namespace lngs::testing::helper {
 		if (with_keys) file.keys.reserve(defs.strings.size());
 
 		for (auto& string : defs.strings) {
-			file.strings.emplace_back(string.id, string.value);
-			if (with_keys) file.keys.emplace_back(string.id, string.key);
+			file.strings.emplace_back(string.id, std::string{string.value});
+			if (with_keys)
+				file.keys.emplace_back(string.id, std::string{string.key});
 		}
 
 		for (auto [id, attr] : attrs.vals)
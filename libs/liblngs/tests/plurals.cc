@@ -1,5 +1,6 @@
 #include <gtest/gtest.h>
 #include <lngs/plurals.hpp>
+#include <vector>
 
 namespace lngs::plurals::testing {
 	using namespace ::std::literals;
@@ -140,6 +141,25 @@ namespace lngs::plurals::testing {
 		}
 	}
 
+	TEST_P(plurals, many) {
+		auto lex = decode(GetParam().code);
+
+		std::vector<intmax_t> counts;
+		for (intmax_t n = -20; n < 300; ++n)
+			counts.push_back(n);
+		for (intmax_t n : {1000, 1001, 1011, 1022, 123456789})
+			counts.push_back(n);
+
+		std::vector<uint8_t> forms(counts.size());
+		lex.eval_many(counts.data(), forms.data(), counts.size());
+		for (std::size_t index = 0; index < counts.size(); ++index) {
+			auto const expected = lex.eval(counts[index]);
+			auto const form =
+			    expected < 0 || expected > 255 ? 255 : expected;
+			EXPECT_EQ(form, forms[index]) << "  Current: " << counts[index];
+		}
+	}
+
 	constexpr static const oper ops[] = {
 	    "*"sv,  "/"sv, "%"sv,  "+"sv, "-"sv,  unary("!"sv), "=="sv,
 	    "!="sv, "<"sv, "<="sv, ">"sv, ">="sv, "&&"sv,       "||"sv};
@@ -367,6 +387,59 @@ namespace lngs::plurals::testing {
 	         R(22, 25) <= 1,
 	     }}};
 
+	TEST(plurals, interned) {
+		auto const first = intern("nplurals=2; plural=(n > 1);"sv);
+		auto const second = intern("nplurals=2;plural=(n>1);"sv);
+		auto const other = intern("nplurals=2; plural=(n != 1);"sv);
+		ASSERT_TRUE(first);
+		EXPECT_EQ(first.plural, second.plural);
+		EXPECT_NE(first.plural, other.plural);
+		EXPECT_EQ(2, second.nplurals);
+		EXPECT_EQ(0, second.eval(1));
+		EXPECT_EQ(1, second.eval(5));
+
+		auto const parsed = decode("nplurals=2; plural=(n > 1);"sv);
+		EXPECT_NE(first.plural, parsed.plural);
+	}
+
+	constexpr intmax_t native_rule_xx(intmax_t n) noexcept {
+		return n == 1 ? 0 : 7;
+	}
+
+	TEST(plurals, native) {
+		static constexpr auto forms = "nplurals=2; plural=(n != 1);"sv;
+		static native const rules[] = {
+		    {"x-native"sv, forms, 2, native_rule_xx}};
+		native_registrar const registrar{rules};
+
+		auto const lex = decode("nplurals=2;plural=(n!=1);"sv, "x-native"sv);
+		ASSERT_TRUE(lex);
+		EXPECT_EQ(native_rule_xx, lex.native);
+		EXPECT_FALSE(lex.plural);
+		EXPECT_EQ(2, lex.nplurals);
+		EXPECT_EQ(0, lex.eval(1));
+		EXPECT_EQ(7, lex.eval(5));
+
+		intmax_t const counts[] = {0, 1, 2};
+		uint8_t chosen[3] = {};
+		lex.eval_many(counts, chosen, 3);
+		EXPECT_EQ(7, chosen[0]);
+		EXPECT_EQ(0, chosen[1]);
+		EXPECT_EQ(7, chosen[2]);
+
+		auto const other = decode(forms, "x-other"sv);
+		ASSERT_TRUE(other);
+		EXPECT_EQ(nullptr, other.native);
+		EXPECT_EQ(1, other.eval(5));
+
+		auto const changed =
+		    decode("nplurals=2; plural=(n > 1);"sv, "x-native"sv);
+		ASSERT_TRUE(changed);
+		EXPECT_EQ(nullptr, changed.native);
+		EXPECT_EQ(0, changed.eval(1));
+		EXPECT_EQ(1, changed.eval(5));
+	}
+
 	INSTANTIATE_TEST_SUITE_P(ops, plural_ops, ValuesIn(ops));
 	INSTANTIATE_TEST_SUITE_P(exception, plurals, ValuesIn(exception));
 	INSTANTIATE_TEST_SUITE_P(bad, plurals, ValuesIn(bad));
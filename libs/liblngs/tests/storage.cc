@@ -1,7 +1,9 @@
 #include <gtest/gtest.h>
 #include <clocale>
 #include <cstdlib>
+#include <lngs/lngs.hpp>
 #include <lngs/lngs_storage.hpp>
+#include <thread>
 #include "lang_file_helpers.h"
 
 extern std::filesystem::path TESTING_data_path;
@@ -221,6 +223,7 @@ namespace lngs::storage::testing {
 		using Storage::get_attr;
 		using Storage::get_key;
 		using Storage::get_string;
+		using Storage::get_strings;
 	};
 
 	using storage_FileBased = storage<publicize<FileBased>>;
@@ -421,6 +424,410 @@ namespace lngs::storage::testing {
 
 	INSTANTIATE_TEST_SUITE_P(groups, storage_FileBased_open, ValuesIn(groups));
 
+	template <typename Storage>
+	struct counted : publicize<Storage> {
+		using Storage::format;
+
+		lang_file::identifier id(std::string_view key) const noexcept {
+			return static_cast<lang_file::identifier>(this->find_key(key));
+		}
+
+		std::size_t format(lang_file::identifier val) const noexcept {
+			char buffer[64];
+			return Storage::format(val, nullptr, 0, buffer, sizeof(buffer));
+		}
+	};
+
+	template <typename Storage>
+	void open_pkg1(Storage& tr) {
+		tr.template path_manager<manager::ExtensionPath>(
+		    TESTING_data_path / "testset1.ext", "pkg1");
+		ASSERT_TRUE(tr.open("foo", SerialNumber::UseAny));
+	}
+
+	constexpr auto missing = static_cast<lang_file::identifier>(5000);
+
+	TEST(storage, statistics_disabled) {
+		counted<FileWithBuiltin<vector_resource>> tr;
+		vector_resource::bytes = &pkg1_builtin();
+		ASSERT_TRUE(tr.init_builtin());
+		open_pkg1(tr);
+
+		EXPECT_FALSE(tr.get_string(tr.id("YES")).empty());
+		EXPECT_TRUE(tr.get_string(missing).empty());
+		EXPECT_EQ(stats::snapshot{}, tr.statistics());
+	}
+
+	TEST(storage, statistics_file) {
+		counted<BasicFileBased<stats::counters>> tr;
+		open_pkg1(tr);
+
+		EXPECT_FALSE(tr.get_string(tr.id("YES")).empty());
+		EXPECT_FALSE(
+		    tr.get_string(tr.id("NO"), lang_file::quantity{2}).empty());
+		EXPECT_TRUE(tr.get_string(tr.id("EX")).empty());
+		EXPECT_EQ(0u, tr.format(missing));
+		EXPECT_EQ((stats::snapshot{4, 2, 0}), tr.statistics());
+
+		auto copy = tr;
+		EXPECT_FALSE(copy.get_string(copy.id("MAYBE")).empty());
+		EXPECT_EQ((stats::snapshot{5, 2, 0}), tr.statistics());
+	}
+
+	TEST(storage, statistics_builtin) {
+		counted<Builtin<vector_resource, stats::counters>> tr;
+		vector_resource::bytes = &pkg1_builtin();
+		ASSERT_TRUE(tr.init_builtin());
+
+		EXPECT_FALSE(tr.get_string(tr.id("EX")).empty());
+		EXPECT_NE(0u, tr.format(tr.id("TRA")));
+		EXPECT_TRUE(tr.get_string(missing).empty());
+		EXPECT_EQ((stats::snapshot{3, 1, 0}), tr.statistics());
+	}
+
+	TEST(storage, statistics_fallback) {
+		counted<FileWithBuiltin<vector_resource, stats::counters>> tr;
+		vector_resource::bytes = &pkg1_builtin();
+		ASSERT_TRUE(tr.init_builtin());
+		open_pkg1(tr);
+
+		EXPECT_FALSE(tr.get_string(tr.id("YES")).empty());
+		EXPECT_FALSE(tr.get_string(tr.id("EX")).empty());
+		EXPECT_FALSE(
+		    tr.get_string(tr.id("TRA"), lang_file::quantity{2}).empty());
+		EXPECT_NE(0u, tr.format(tr.id("KEYS")));
+		EXPECT_NE(0u, tr.format(tr.id("MAYBE")));
+		EXPECT_TRUE(tr.get_string(missing).empty());
+		EXPECT_EQ(0u, tr.format(missing));
+		EXPECT_EQ((stats::snapshot{7, 2, 3}), tr.statistics());
+	}
+
+	TEST(storage, statistics_threads) {
+		counted<FileWithBuiltin<vector_resource, stats::counters>> tr;
+		vector_resource::bytes = &pkg1_builtin();
+		ASSERT_TRUE(tr.init_builtin());
+		open_pkg1(tr);
+
+		auto const yes = tr.id("YES");
+		auto const ex = tr.id("EX");
+		std::vector<std::thread> threads;
+		for (int thread = 0; thread < 24; ++thread) {
+			threads.emplace_back([&] {
+				for (int index = 0; index < 1000; ++index) {
+					tr.get_string(yes);
+					tr.get_string(ex);
+					tr.get_string(missing);
+				}
+			});
+		}
+		for (auto& thread : threads)
+			thread.join();
+
+		EXPECT_EQ((stats::snapshot{72000, 24000, 24000}), tr.statistics());
+	}
+
+	TEST(storage, missing_keys) {
+		counted<FileWithBuiltin<vector_resource, stats::missing>> tr;
+		vector_resource::bytes = &pkg1_builtin();
+		ASSERT_TRUE(tr.init_builtin());
+		open_pkg1(tr);
+
+		EXPECT_FALSE(tr.get_string(tr.id("YES")).empty());
+		EXPECT_FALSE(tr.get_string(tr.id("EX")).empty());
+		EXPECT_TRUE(tr.get_string(missing).empty());
+		EXPECT_NE(0u, tr.format(tr.id("KEYS")));
+		EXPECT_FALSE(tr.get_string(tr.id("EX")).empty());
+		EXPECT_EQ((std::vector<uint32_t>{1003, 1005, 5000}), tr.statistics());
+
+		auto const keys = tr.missing_keys();
+		ASSERT_EQ(3u, keys.size());
+		EXPECT_EQ(1003u, keys[0].id);
+		EXPECT_EQ("EX"sv, keys[0].key);
+		EXPECT_EQ(1005u, keys[1].id);
+		EXPECT_EQ("KEYS"sv, keys[1].key);
+		EXPECT_EQ(5000u, keys[2].id);
+		EXPECT_EQ(""sv, keys[2].key);
+	}
+
+	TEST(storage, missing_bitmap) {
+		stats::basic_missing<128> bits;
+		bits.add(3, true);
+		bits.add(5, false);
+		bits.add(7, false, true);
+		bits.add(64, true);
+		bits.add(127, true, false);
+		bits.add(128, true);
+		bits.add(3, true);
+		bits.add(0x10000, false, true);
+		bits.add(0x10001, false);
+		EXPECT_EQ((std::vector<uint32_t>{3, 7, 64, 127}), bits.get());
+		EXPECT_EQ(2u, bits.get().overflow);
+
+		auto copy = bits;
+		copy.clear();
+		EXPECT_TRUE(bits.get().empty());
+		EXPECT_EQ(0u, bits.get().overflow);
+	}
+
+	struct recorder {
+		static constexpr bool enabled = true;
+		static std::vector<std::string> events;
+
+		static void open(std::string_view lang) noexcept {
+			events.push_back("open " + std::string{lang});
+		}
+		static void reload(std::string_view lang) noexcept {
+			events.push_back("reload " + std::string{lang});
+		}
+		static void opened(std::string_view lang, bool ok) noexcept {
+			events.push_back("opened " + std::string{lang} +
+			                 (ok ? " ok" : " failed"));
+		}
+		static void miss(uint32_t id, trace::source where) noexcept {
+			events.push_back(
+			    "miss " + std::to_string(id) +
+			    (where == trace::source::file ? " file" : " builtin"));
+		}
+		static void plural(uint32_t id, intmax_t count) noexcept {
+			events.push_back("plural " + std::to_string(id) + " " +
+			                 std::to_string(count));
+		}
+	};
+	std::vector<std::string> recorder::events{};
+
+	static_assert(!trace::none::enabled);
+
+	TEST(storage, trace_open) {
+		counted<FileWithBuiltin<vector_resource, stats::none, recorder>> tr;
+		vector_resource::bytes = &pkg1_builtin();
+		ASSERT_TRUE(tr.init_builtin());
+		recorder::events.clear();
+
+		open_pkg1(tr);
+		EXPECT_TRUE(tr.open("foo", SerialNumber::UseAny));
+		EXPECT_FALSE(tr.open("timey-WIMEY", SerialNumber::UseAny));
+		EXPECT_TRUE(tr.open_first_of({"fred", "bar"}, SerialNumber::UseAny));
+
+		std::vector<std::string> const expected{
+		    "open foo",           "opened foo ok",
+		    "reload foo",         "opened foo ok",
+		    "reload timey-WIMEY", "opened timey-WIMEY failed",
+		    "open fred",          "opened fred failed",
+		    "open bar",           "opened bar ok",
+		};
+		EXPECT_EQ(expected, recorder::events);
+	}
+
+	TEST(storage, trace_lookups) {
+		counted<FileWithBuiltin<vector_resource, stats::none, recorder>> tr;
+		vector_resource::bytes = &pkg1_builtin();
+		ASSERT_TRUE(tr.init_builtin());
+		open_pkg1(tr);
+		auto const yes = tr.id("YES");
+		auto const ex = tr.id("EX");
+		recorder::events.clear();
+
+		EXPECT_FALSE(tr.get_string(yes).empty());
+		EXPECT_FALSE(tr.get_string(ex).empty());
+		EXPECT_TRUE(tr.get_string(missing).empty());
+		EXPECT_FALSE(tr.get_string(yes, lang_file::quantity{2}).empty());
+		EXPECT_FALSE(tr.get_string(ex, lang_file::quantity{5}).empty());
+
+		auto const yes_id = std::to_string(static_cast<uint32_t>(yes));
+		auto const ex_id = std::to_string(static_cast<uint32_t>(ex));
+		std::vector<std::string> const expected{
+		    "miss " + ex_id + " file", "miss 5000 file",
+		    "miss 5000 builtin",       "plural " + yes_id + " 2",
+		    "miss " + ex_id + " file", "plural " + ex_id + " 5",
+		};
+		EXPECT_EQ(expected, recorder::events);
+	}
+
+	TEST(storage, memory_usage) {
+		counted<FileWithBuiltin<vector_resource>> tr;
+		vector_resource::bytes = &pkg1_builtin();
+		ASSERT_TRUE(tr.init_builtin());
+		auto const builtin = tr.memory_usage();
+		EXPECT_EQ(pkg1_builtin().size(), builtin.mapped);
+		EXPECT_NE(0u, builtin.sections.strings);
+		EXPECT_NE(0u, builtin.sections.keys);
+
+		open_pkg1(tr);
+		auto const file_size = std::filesystem::file_size(
+		    TESTING_data_path / "testset1.ext" / "pkg1.foo");
+		auto const usage = tr.memory_usage();
+		EXPECT_EQ(builtin.mapped, usage.mapped);
+		EXPECT_LE(builtin.heap + file_size, usage.heap);
+		EXPECT_EQ(usage.mapped + usage.heap, usage.total());
+
+		auto const& sec = usage.sections;
+		EXPECT_LT(builtin.sections.strings, sec.strings);
+		EXPECT_LE(sec.attrs + sec.strings + sec.keys + sec.formats,
+		          file_size + pkg1_builtin().size());
+
+		// the plural expression is parsed on first use
+		EXPECT_FALSE(
+		    tr.get_string(tr.id("YES"), lang_file::quantity{2}).empty());
+		EXPECT_LT(usage.heap, tr.memory_usage().heap);
+
+		EXPECT_FALSE(tr.open("timey-WIMEY", SerialNumber::UseAny));
+		auto const closed = tr.memory_usage();
+		EXPECT_EQ(builtin.mapped, closed.mapped);
+		EXPECT_EQ(builtin.heap, closed.heap);
+		EXPECT_EQ(builtin.sections.strings, closed.sections.strings);
+	}
+
+	struct static_resource {
+		static const static_table table;
+	};
+
+	constexpr uint32_t static_ids[] = {1000, 1003, 1004};
+	constexpr std::string_view static_strings[] = {
+	    "static:yes"sv, "static:additional"sv, "{0} item\0{0} items"sv};
+	constexpr std::string_view static_keys[] = {"YES"sv, "EX"sv, "ITEMS"sv};
+	const static_table static_resource::table{
+	    static_ids, static_strings, static_keys, std::size(static_ids),
+	    "nplurals=2; plural=(n != 1);"sv};
+
+	static_assert(std::is_same_v<
+	              builtin_for<static_resource, stats::none, trace::none>,
+	              StaticBuiltin<static_resource, stats::none, trace::none>>);
+	static_assert(std::is_same_v<
+	              builtin_for<vector_resource, stats::none, trace::none>,
+	              Builtin<vector_resource, stats::none, trace::none>>);
+
+	TEST(storage, static_builtin) {
+		counted<StaticBuiltin<static_resource, stats::counters>> tr;
+		ASSERT_TRUE(tr.init_builtin());
+
+		EXPECT_EQ(1004u, tr.find_key("ITEMS"));
+		EXPECT_EQ("EX"sv, tr.get_key(1003));
+		EXPECT_EQ(""sv, tr.get_key(1001));
+		EXPECT_EQ("nplurals=2; plural=(n != 1);"sv,
+		          tr.get_attr(ATTR_PLURALS));
+
+		auto const items = tr.id("ITEMS");
+		EXPECT_EQ("static:yes"sv, tr.get_string(tr.id("YES")));
+		EXPECT_EQ("{0} item"sv, tr.get_string(items));
+		EXPECT_EQ("{0} item"sv, tr.get_string(items, lang_file::quantity{1}));
+		EXPECT_EQ("{0} items"sv,
+		          tr.get_string(items, lang_file::quantity{5}));
+		EXPECT_TRUE(tr.get_string(missing).empty());
+
+		char buffer[64];
+		std::string_view const args[] = {"5"sv};
+		auto const length =
+		    tr.format(items, lang_file::quantity{5}, args, std::size(args),
+		              buffer, sizeof(buffer));
+		EXPECT_EQ("5 items"sv, std::string_view(buffer, length));
+		EXPECT_EQ(0u, tr.format(missing));
+		EXPECT_EQ((stats::snapshot{7, 2, 0}), tr.statistics());
+
+		auto const usage = tr.memory_usage();
+		EXPECT_EQ(0u, usage.heap);
+		EXPECT_EQ(45u, usage.sections.strings);
+		EXPECT_EQ(10u, usage.sections.keys);
+		EXPECT_LT(usage.sections.strings + usage.sections.keys,
+		          usage.mapped);
+	}
+
+	TEST(storage, static_fallback) {
+		counted<FileWithBuiltin<static_resource, stats::counters>> tr;
+		ASSERT_TRUE(tr.init_builtin());
+		open_pkg1(tr);
+
+		EXPECT_EQ("foo:yes"sv, tr.get_string(tr.id("YES")));
+		EXPECT_EQ("static:additional"sv, tr.get_string(tr.id("EX")));
+		EXPECT_EQ("{0} items"sv, tr.get_string(tr.id("ITEMS"),
+		                                        lang_file::quantity{2}));
+		EXPECT_TRUE(tr.get_string(missing).empty());
+		EXPECT_EQ((stats::snapshot{4, 1, 2}), tr.statistics());
+	}
+
+	enum class static_lng : uint32_t { YES = 1000, EX = 1003, ITEMS = 1004 };
+	constexpr uint32_t static_slots[] = {0, no_slot, no_slot, 1, 2};
+	constexpr lang_file::slot slot_of(static_lng val) noexcept {
+		return slot_in(static_slots, 1000, val);
+	}
+
+	static_assert(slot_of(static_lng::ITEMS) == lang_file::slot{2});
+	static_assert(slot_of(static_cast<static_lng>(999)) ==
+	              lang_file::slot{no_slot});
+	static_assert(slot_of(static_cast<static_lng>(1005)) ==
+	              lang_file::slot{no_slot});
+
+	TEST(storage, static_slots) {
+		SingularStrings<static_lng, StaticBuiltin<static_resource>> builtin;
+		ASSERT_TRUE(builtin.init_builtin());
+		EXPECT_EQ("static:yes"sv, builtin(static_lng::YES));
+		EXPECT_EQ("{0} item"sv, builtin(static_lng::ITEMS));
+
+		// pkg1 is not dense, so the slots miss and the strings are searched
+		SingularStrings<static_lng,
+		                VersionedFile<0, FileWithBuiltin<static_resource>>>
+		    tr;
+		ASSERT_TRUE(tr.init_builtin());
+		open_pkg1(tr);
+		EXPECT_EQ("foo:yes"sv, tr(static_lng::YES));
+		EXPECT_EQ("static:additional"sv, tr(static_lng::EX));
+	}
+
+	constexpr key_entry<static_lng> static_keys_map[] = {
+	    {"EX"sv, static_lng::EX},
+	    {"ITEMS"sv, static_lng::ITEMS},
+	    {"YES"sv, static_lng::YES},
+	};
+	constexpr auto const& keys_of(key_tag<static_lng>) noexcept {
+		return static_keys_map;
+	}
+
+	static_assert(id_of<static_lng>("EX") == static_lng::EX);
+	static_assert(id_of<static_lng>("YES") == static_lng::YES);
+
+	TEST(storage, plural_column) {
+		intmax_t const counts[] = {0, 1, 2, 5, 1};
+		std::string_view forms[std::size(counts)];
+
+		PluralOnlyStrings<static_lng,
+		                  StaticBuiltin<static_resource, stats::counters>>
+		    builtin;
+		ASSERT_TRUE(builtin.init_builtin());
+		EXPECT_TRUE(
+		    builtin(static_lng::ITEMS, counts, forms, std::size(counts)));
+		EXPECT_EQ("{0} items"sv, forms[0]);
+		EXPECT_EQ("{0} item"sv, forms[1]);
+		EXPECT_EQ("{0} items"sv, forms[3]);
+		EXPECT_EQ("{0} item"sv, forms[4]);
+		EXPECT_FALSE(builtin(static_cast<static_lng>(5000), counts, forms,
+		                     std::size(counts)));
+		EXPECT_TRUE(forms[0].empty());
+		EXPECT_EQ((stats::snapshot{2, 1, 0}), builtin.statistics());
+
+		// ITEMS is not in pkg1, so the whole column comes from the builtin
+		counted<FileWithBuiltin<static_resource, stats::counters>> tr;
+		ASSERT_TRUE(tr.init_builtin());
+		open_pkg1(tr);
+		auto const items = tr.id("ITEMS");
+		EXPECT_TRUE(tr.get_strings(items, counts, forms, std::size(counts)));
+		for (std::size_t index = 0; index < std::size(counts); ++index) {
+			EXPECT_EQ(tr.get_string(items, lang_file::quantity{counts[index]}),
+			          forms[index]);
+		}
+		EXPECT_EQ((stats::snapshot{6, 0, 6}), tr.statistics());
+	}
+
+	TEST(storage, static_keys) {
+		EXPECT_EQ(static_cast<static_lng>(no_slot), id_of<static_lng>("NO"));
+		EXPECT_EQ(static_cast<static_lng>(no_slot), id_of<static_lng>(""));
+
+#ifdef LNGS_HAS_KEY_LITERALS
+		SingularStrings<static_lng, StaticBuiltin<static_resource>> tr;
+		ASSERT_TRUE(tr.init_builtin());
+		EXPECT_EQ("static:yes"sv, tr.get<"YES">());
+		EXPECT_EQ("{0} item"sv, tr.get<"ITEMS">());
+#endif
+	}
+
 	static const header headers[] = {
 	    {{}, {"en"}},
 	    {
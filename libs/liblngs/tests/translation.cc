@@ -205,6 +205,92 @@ namespace lngs::testing {
 		tr.add_onupdate({});
 	}
 
+	TEST_P(translation, update_event) {
+		auto& param = GetParam();
+
+		auto root = TESTING_data_path / param.root;
+		lngs::translation tr;
+		if (root.extension() == ".ext") {
+			tr.path_manager<manager::ExtensionPath>(root, param.name);
+		} else {
+			tr.path_manager<manager::SubdirPath>(root, param.name);
+		}
+
+		std::vector<update_event> events;
+		auto token = tr.add_onupdate(
+		    [&](update_event const& event) { events.push_back(event); });
+
+		for (auto const& ll_CC : param.expected_known) {
+			EXPECT_TRUE(tr.open(ll_CC.lang, SerialNumber::UseAny));
+		}
+		EXPECT_FALSE(tr.open("timey-WIMEY", SerialNumber::UseAny));
+		auto const& first = param.expected_known.begin()->lang;
+		EXPECT_FALSE(tr.open(first, SerialNumber{1}));
+
+		ASSERT_EQ(param.expected_known.size() + 2, events.size());
+		auto it = events.begin();
+		for (auto const& ll_CC : param.expected_known) {
+			auto const& event = *it++;
+			EXPECT_EQ(ll_CC.lang, event.lang);
+			EXPECT_TRUE(event.ok);
+			EXPECT_FALSE(event.serial_mismatch);
+			EXPECT_NE(0u, event.bytes);
+			EXPECT_EQ(param.keys.size(), event.strings);
+			EXPECT_TRUE(std::filesystem::exists(event.path)) << event.path;
+		}
+
+		auto const& missing = *it++;
+		EXPECT_EQ("timey-WIMEY"sv, missing.lang);
+		EXPECT_FALSE(missing.ok);
+		EXPECT_FALSE(missing.serial_mismatch);
+		EXPECT_EQ(0u, missing.bytes);
+		EXPECT_EQ(0u, missing.strings);
+		EXPECT_EQ(0, missing.validate_time.count());
+
+		auto const& mismatch = *it++;
+		EXPECT_EQ(first, mismatch.lang);
+		EXPECT_FALSE(mismatch.ok);
+		EXPECT_TRUE(mismatch.serial_mismatch);
+		EXPECT_NE(0u, mismatch.bytes);
+
+		auto const& metrics = tr.metrics();
+		EXPECT_EQ(events.size(), metrics.read.count());
+		EXPECT_EQ(events.size() - 1, metrics.validate.count());
+		EXPECT_EQ(mismatch.read_time, metrics.read.last());
+		EXPECT_EQ(mismatch.validate_time, metrics.validate.last());
+
+		tr.remove_onupdate(token);
+	}
+
+	TEST(duration_histogram, buckets) {
+		using namespace std::chrono;
+		using hist = duration_histogram;
+		EXPECT_EQ(0u, hist::bucket_of(nanoseconds{999}));
+		EXPECT_EQ(1u, hist::bucket_of(microseconds{1}));
+		EXPECT_EQ(2u, hist::bucket_of(microseconds{3}));
+		EXPECT_EQ(10u, hist::bucket_of(milliseconds{1}));
+		EXPECT_EQ(hist::bucket_count - 1, hist::bucket_of(seconds{60}));
+
+		hist durations;
+		durations.add(milliseconds{250});
+		for (uint64_t index = 1; index < hist::window; ++index)
+			durations.add(microseconds{3});
+		EXPECT_EQ(hist::window, durations.count());
+		EXPECT_EQ(hist::window - 1, durations.buckets()[2]);
+		EXPECT_EQ(1u, durations.buckets()[18]);
+
+		durations.add(microseconds{1});
+		EXPECT_EQ((hist::window - 1) / 2, durations.buckets()[2]);
+		EXPECT_EQ(0u, durations.buckets()[18]);
+		EXPECT_EQ(1u, durations.buckets()[1]);
+		EXPECT_EQ((hist::window - 1) / 2 + 1, durations.count());
+		EXPECT_EQ(microseconds{1}, durations.last());
+		EXPECT_EQ(milliseconds{250}, durations.max());
+
+		durations.clear();
+		EXPECT_EQ(0u, durations.count());
+	}
+
 	TEST_P(translation, keys) {
 		auto& param = GetParam();
 
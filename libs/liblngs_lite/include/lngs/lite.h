@@ -17,6 +17,7 @@
 #define STRINGS_API DLL_IMPORT
 #endif
 
+#include <stddef.h>
 #include <stdint.h>
 
 #ifdef __cplusplus
@@ -27,9 +28,35 @@ typedef struct StringsTag {
 	int _Placeholder;
 } * HSTRINGS;
 
+/* reads the file into memory; handles opened for the same, unchanged file
+ * share one copy, released with the last of them */
 STRINGS_API(HSTRINGS) OpenStrings(const char* path);
+/* as OpenStrings, but maps the file read-only instead of copying it; the
+ * file must not be rewritten in place (as lngs make does) while a handle
+ * is open, or the strings change under the handle, or reading them
+ * crashes; replacing the file (writing a new one and renaming it over the
+ * old one) is safe */
+STRINGS_API(HSTRINGS) OpenStringsMapped(const char* path);
+/* uses the data in place; it must outlive the handle and start at a 4-byte
+ * boundary, otherwise NULL is returned */
+STRINGS_API(HSTRINGS) OpenStringsFromMemory(const void* data, size_t size);
 STRINGS_API(const char*) ReadString(HSTRINGS, uint32_t);
 STRINGS_API(const char*) ReadStringPl(HSTRINGS, uint32_t, intmax_t);
+/* as ReadString/ReadStringPl, storing the string length in *length */
+STRINGS_API(const char*) ReadStringEx(HSTRINGS, uint32_t, size_t* length);
+STRINGS_API(const char*)
+ReadStringPlEx(HSTRINGS, uint32_t, intmax_t, size_t* length);
+/* reads count strings at once; lengths may be NULL; returns the number of
+ * strings found */
+STRINGS_API(size_t)
+ReadStrings(HSTRINGS,
+            const uint32_t* ids,
+            size_t count,
+            const char** strings,
+            size_t* lengths);
+/* the whole catalog, as seen by the handle; strings returned by the Read*
+ * functions point inside this block */
+STRINGS_API(const void*) GetStringsData(HSTRINGS, size_t* size);
 STRINGS_API(void) CloseStrings(HSTRINGS);
 
 #ifdef __cplusplus
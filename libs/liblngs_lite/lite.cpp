@@ -9,8 +9,17 @@
 #undef max
 #endif
 
+#ifndef _WIN32
+#include <sys/stat.h>
+#endif
+
 #include <lngs/lngs_file.hpp>
 #include <lngs/translation.hpp>
+#include <map>
+#include <memory>
+#include <mutex>
+#include <optional>
+#include <tuple>
 
 #ifdef _WIN32
 #define API(T, name) T __stdcall name
@@ -19,61 +28,287 @@
 #endif
 
 namespace lngs {
-	class DllTranslation {
+	class Catalog {
 		memory_block m_data;
+		mapped_file m_mapped;
+		memory_view m_view;
 		lang_file m_file;
 
+		bool opened(const memory_view& view) {
+			m_view = view;
+
+			// decode the Plural-Forms now; the lazy decoding in lang_file
+			// would race, once the catalog is shared between threads
+			m_file.calc_substring(lang_file::quantity{1});
+			return true;
+		}
+
 	public:
 		using identifier = lang_file::identifier;
 		using quantity = lang_file::quantity;
 
-		bool open(const char* path) {
-			m_data = translation::open_file(path);
-			if (!m_file.open(m_data)) {
+		bool open(const std::filesystem::path& path, bool mapped) {
+			if (mapped) {
+				m_mapped = mapped_file::open(path);
+				if (m_file.open(m_mapped)) return opened(m_mapped);
 				m_file.close();
-				m_data = memory_block{};
-				return false;
+				m_mapped = mapped_file{};
+				// not every file can be mapped; try to read it whole
 			}
-			return true;
+
+			m_data = translation::open_file(path);
+			if (m_file.open(m_data)) return opened(m_data);
+			m_file.close();
+			m_data = memory_block{};
+			return false;
 		}
 
-		const char* get_string(identifier id) const {
-			return m_file.get_string(id).data();
+		bool open(const memory_view& view) {
+			if (m_file.open(view)) return opened(view);
+			m_file.close();
+			return false;
 		}
 
-		const char* get_string(identifier id, quantity count) const {
-			return m_file.get_string(id, count).data();
+		memory_view const& view() const noexcept { return m_view; }
+
+		std::string_view get_string(identifier id) const {
+			return m_file.get_string(id);
+		}
+
+		std::string_view get_string(identifier id, quantity count) const {
+			return m_file.get_string(id, count);
 		}
 	};
 
+	// Process-wide list of catalogs opened from files. Handles opened for
+	// the same, unchanged file share one copy (or mapping) and one
+	// lang_file, which is released together with the last handle.
+	class CatalogRegistry {
+		struct key {
+			std::filesystem::path::string_type path{};
+			uintmax_t size{};
+			std::filesystem::file_time_type::rep mtime{};
+			bool mapped{};
+#ifndef _WIN32
+			dev_t device{};
+			ino_t inode{};
+
+			auto tie() const noexcept {
+				return std::tie(path, size, mtime, mapped, device, inode);
+			}
+#else
+			auto tie() const noexcept {
+				return std::tie(path, size, mtime, mapped);
+			}
+#endif
+
+			bool operator<(key const& rhs) const noexcept {
+				return tie() < rhs.tie();
+			}
+
+			bool operator==(key const& rhs) const noexcept {
+				return tie() == rhs.tie();
+			}
+		};
+
+		std::mutex m_lock;
+		std::map<key, std::weak_ptr<Catalog const>> m_catalogs;
+
+		static std::optional<key> identify(const char* path, bool mapped) {
+			std::error_code ec;
+			auto canonical = std::filesystem::canonical(path, ec);
+			if (ec) return std::nullopt;
+
+			key result{};
+			result.mapped = mapped;
+			result.size = std::filesystem::file_size(canonical, ec);
+			if (ec) return std::nullopt;
+			result.mtime = std::filesystem::last_write_time(canonical, ec)
+			                   .time_since_epoch()
+			                   .count();
+			if (ec) return std::nullopt;
+
+#ifndef _WIN32
+			struct stat st {};
+			if (::stat(canonical.c_str(), &st)) return std::nullopt;
+			result.device = st.st_dev;
+			result.inode = st.st_ino;
+#endif
+
+			result.path = canonical.native();
+			return result;
+		}
+
+		std::shared_ptr<Catalog const> find(key const& id) {
+			std::lock_guard<std::mutex> guard{m_lock};
+
+			for (auto it = m_catalogs.begin(); it != m_catalogs.end();) {
+				if (it->second.expired())
+					it = m_catalogs.erase(it);
+				else
+					++it;
+			}
+
+			auto it = m_catalogs.find(id);
+			if (it == m_catalogs.end()) return {};
+			return it->second.lock();
+		}
+
+	public:
+		static CatalogRegistry& instance() {
+			static CatalogRegistry registry;
+			return registry;
+		}
+
+		std::shared_ptr<Catalog const> open(const char* path, bool mapped) {
+			if (!path) return {};
+			auto id = identify(path, mapped);
+			if (!id) return {};
+
+			if (auto catalog = find(*id)) return catalog;
+
+			// reading the file may take a while; do not hold the lock
+			// for other files
+			auto catalog = std::make_shared<Catalog>();
+			if (!catalog->open(id->path, mapped)) return {};
+
+			// the file could have been replaced, while it was opened;
+			// the catalog is fine to use, but not under the old key
+			auto after = identify(path, mapped);
+			if (!after || !(*after == *id)) return catalog;
+
+			std::lock_guard<std::mutex> guard{m_lock};
+			auto& entry = m_catalogs[*id];
+			if (auto other = entry.lock()) return other;
+			entry = catalog;
+			return catalog;
+		}
+	};
+
+	class DllTranslation {
+		std::shared_ptr<Catalog const> m_catalog;
+
+	public:
+		using identifier = lang_file::identifier;
+		using quantity = lang_file::quantity;
+
+		bool open(const char* path, bool mapped) {
+			m_catalog = CatalogRegistry::instance().open(path, mapped);
+			return !!m_catalog;
+		}
+
+		bool open(const memory_view& view) {
+			auto catalog = std::make_shared<Catalog>();
+			if (!catalog->open(view)) return false;
+			m_catalog = std::move(catalog);
+			return true;
+		}
+
+		memory_view const& view() const noexcept { return m_catalog->view(); }
+
+		std::string_view get_string(identifier id) const {
+			return m_catalog->get_string(id);
+		}
+
+		std::string_view get_string(identifier id, quantity count) const {
+			return m_catalog->get_string(id, count);
+		}
+	};
 }  // namespace lngs
 
 namespace {
 	inline auto from(HSTRINGS opaque) {
 		return reinterpret_cast<lngs::DllTranslation*>(opaque);
 	}
+
+	template <typename... Args>
+	HSTRINGS open_with(bool (lngs::DllTranslation::*open)(Args...),
+	                   Args... args) {
+		auto tr = std::make_unique<lngs::DllTranslation>();
+		if (!((*tr).*open)(args...)) return nullptr;
+
+		return reinterpret_cast<HSTRINGS>(tr.release());
+	}
+
+	inline const char* result(std::string_view str, size_t* length) {
+		if (length) *length = str.size();
+		return str.data();
+	}
 }  // namespace
 
 API(HSTRINGS, OpenStrings)(const char* path) {
-	auto tr = std::make_unique<lngs::DllTranslation>();
-	if (!tr->open(path)) return nullptr;
+	return open_with<const char*, bool>(&lngs::DllTranslation::open, path,
+	                                    false);
+}
+
+API(HSTRINGS, OpenStringsMapped)(const char* path) {
+	return open_with<const char*, bool>(&lngs::DllTranslation::open, path,
+	                                    true);
+}
 
-	return reinterpret_cast<HSTRINGS>(tr.release());
+API(HSTRINGS, OpenStringsFromMemory)(const void* data, size_t size) {
+	// lang_file reads the data as 32-bit words
+	if (!data || reinterpret_cast<uintptr_t>(data) % 4) return nullptr;
+	lngs::memory_view view;
+	view.contents = static_cast<std::byte const*>(data);
+	view.size = size;
+	return open_with<const lngs::memory_view&>(&lngs::DllTranslation::open,
+	                                           view);
 }
 
 API(const char*, ReadString)(HSTRINGS opaque, uint32_t id) {
+	return ReadStringEx(opaque, id, nullptr);
+}
+
+API(const char*, ReadStringPl)(HSTRINGS opaque, uint32_t id, intmax_t count) {
+	return ReadStringPlEx(opaque, id, count, nullptr);
+}
+
+API(const char*, ReadStringEx)(HSTRINGS opaque, uint32_t id, size_t* length) {
+	if (length) *length = 0;
 	auto tr = from(opaque);
 	if (!tr) return nullptr;
 	auto const ident = static_cast<lngs::lang_file::identifier>(id);
-	return tr->get_string(ident);
+	return result(tr->get_string(ident), length);
 }
 
-API(const char*, ReadStringPl)(HSTRINGS opaque, uint32_t id, intmax_t count) {
+API(const char*, ReadStringPlEx)
+(HSTRINGS opaque, uint32_t id, intmax_t count, size_t* length) {
+	if (length) *length = 0;
 	auto tr = from(opaque);
 	if (!tr) return nullptr;
 	auto const ident = static_cast<lngs::lang_file::identifier>(id);
 	auto const quantity = static_cast<lngs::lang_file::quantity>(count);
-	return tr->get_string(ident, quantity);
+	return result(tr->get_string(ident, quantity), length);
+}
+
+API(size_t, ReadStrings)
+(HSTRINGS opaque,
+ const uint32_t* ids,
+ size_t count,
+ const char** strings,
+ size_t* lengths) {
+	auto tr = from(opaque);
+	if (!ids || !strings) return 0;
+
+	size_t found = 0;
+	for (size_t index = 0; index < count; ++index) {
+		auto const ident = static_cast<lngs::lang_file::identifier>(ids[index]);
+		auto const str = tr ? tr->get_string(ident) : std::string_view{};
+		strings[index] = str.data();
+		if (lengths) lengths[index] = str.size();
+		if (str.data()) ++found;
+	}
+	return found;
+}
+
+API(const void*, GetStringsData)(HSTRINGS opaque, size_t* size) {
+	if (size) *size = 0;
+	auto tr = from(opaque);
+	if (!tr) return nullptr;
+	auto const& view = tr->view();
+	if (size) *size = static_cast<size_t>(view.size);
+	return view.contents;
 }
 
 API(void, CloseStrings)(HSTRINGS opaque) {
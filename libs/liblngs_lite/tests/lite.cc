@@ -0,0 +1,255 @@
+#include <gtest/gtest.h>
+#include <lngs/lite.h>
+#include <diags/streams.hpp>
+#include <filesystem>
+#include <fstream>
+#include <lngs/internals/languages.hpp>
+#include <string>
+#include <vector>
+
+namespace lngs::testing {
+	using namespace ::std::literals;
+
+	static std::vector<std::byte> catalog(std::string const& file_string) {
+		std::vector<std::byte> out;
+
+		struct stream : diags::outstream {
+			std::vector<std::byte>& contents;
+
+			stream(std::vector<std::byte>& contents) : contents{contents} {}
+			std::size_t write(const void* data,
+			                  std::size_t length) noexcept final {
+				auto b = static_cast<const std::byte*>(data);
+				auto e = b + length;
+				auto size = contents.size();
+				contents.insert(end(contents), b, e);
+				return contents.size() - size;
+			}
+		} output{out};
+
+		app::file file;
+		file.attrs.emplace_back(ATTR_PLURALS, "nplurals=2; plural=(n != 1);");
+		file.strings.emplace_back(1, "{0} file\0{0} files"s);
+		file.strings.emplace_back(2, file_string);
+		file.write(output);
+		return out;
+	}
+
+	struct lite : ::testing::Test {
+		std::filesystem::path dir{std::filesystem::temp_directory_path() /
+		                          "lngs_lite-test"};
+
+		void SetUp() override { std::filesystem::create_directories(dir); }
+		void TearDown() override {
+			std::error_code ec;
+			std::filesystem::remove_all(dir, ec);
+		}
+
+		std::string write(std::string const& filename,
+		                  std::string const& file_string) {
+			auto const bytes = catalog(file_string);
+			auto const tmp = dir / (filename + ".tmp");
+			auto const path = dir / filename;
+			{
+				std::ofstream out{tmp, std::ios::binary};
+				out.write(reinterpret_cast<char const*>(bytes.data()),
+				          static_cast<std::streamsize>(bytes.size()));
+			}
+			std::filesystem::rename(tmp, path);
+			return path.string();
+		}
+
+		static std::string_view read(HSTRINGS handle, uint32_t id) {
+			size_t length{};
+			auto str = ReadStringEx(handle, id, &length);
+			return str ? std::string_view{str, length} : std::string_view{};
+		}
+	};
+
+	TEST_F(lite, read_string_ex) {
+		auto const bytes = catalog("second");
+		auto handle = OpenStringsFromMemory(bytes.data(), bytes.size());
+		ASSERT_NE(nullptr, handle);
+
+		size_t length = 100;
+		auto str = ReadStringEx(handle, 2, &length);
+		ASSERT_NE(nullptr, str);
+		EXPECT_EQ("second"sv, (std::string_view{str, length}));
+
+		// the singular form of a plural string
+		EXPECT_EQ("{0} file"sv, read(handle, 1));
+		EXPECT_STREQ("{0} file", ReadString(handle, 1));
+
+		length = 100;
+		EXPECT_EQ(nullptr, ReadStringEx(handle, 3, &length));
+		EXPECT_EQ(0u, length);
+
+		length = 100;
+		EXPECT_EQ(nullptr, ReadStringEx(nullptr, 2, &length));
+		EXPECT_EQ(0u, length);
+
+		CloseStrings(handle);
+	}
+
+	TEST_F(lite, read_string_pl_ex) {
+		auto const bytes = catalog("second");
+		auto handle = OpenStringsFromMemory(bytes.data(), bytes.size());
+		ASSERT_NE(nullptr, handle);
+
+		size_t length = 100;
+		auto str = ReadStringPlEx(handle, 1, 1, &length);
+		ASSERT_NE(nullptr, str);
+		EXPECT_EQ("{0} file"sv, (std::string_view{str, length}));
+
+		str = ReadStringPlEx(handle, 1, 5, &length);
+		ASSERT_NE(nullptr, str);
+		EXPECT_EQ("{0} files"sv, (std::string_view{str, length}));
+		EXPECT_STREQ("{0} files", ReadStringPl(handle, 1, 0));
+
+		length = 100;
+		EXPECT_EQ(nullptr, ReadStringPlEx(handle, 3, 5, &length));
+		EXPECT_EQ(0u, length);
+
+		CloseStrings(handle);
+	}
+
+	TEST_F(lite, read_strings) {
+		auto const bytes = catalog("second");
+		auto handle = OpenStringsFromMemory(bytes.data(), bytes.size());
+		ASSERT_NE(nullptr, handle);
+
+		uint32_t const ids[] = {2, 3, 1};
+		const char* strings[3] = {};
+		size_t lengths[3] = {};
+		EXPECT_EQ(2u, ReadStrings(handle, ids, 3, strings, lengths));
+
+		ASSERT_NE(nullptr, strings[0]);
+		EXPECT_EQ("second"sv, (std::string_view{strings[0], lengths[0]}));
+		EXPECT_EQ(nullptr, strings[1]);
+		EXPECT_EQ(0u, lengths[1]);
+		ASSERT_NE(nullptr, strings[2]);
+		EXPECT_EQ("{0} file"sv, (std::string_view{strings[2], lengths[2]}));
+
+		// lengths are optional
+		const char* again[3] = {};
+		EXPECT_EQ(2u, ReadStrings(handle, ids, 3, again, nullptr));
+		EXPECT_EQ(strings[0], again[0]);
+		EXPECT_EQ(strings[2], again[2]);
+
+		EXPECT_EQ(0u, ReadStrings(handle, nullptr, 3, strings, lengths));
+		EXPECT_EQ(0u, ReadStrings(nullptr, ids, 3, strings, lengths));
+		EXPECT_EQ(nullptr, strings[0]);
+
+		CloseStrings(handle);
+	}
+
+	TEST_F(lite, get_strings_data) {
+		auto const bytes = catalog("second");
+		auto handle = OpenStringsFromMemory(bytes.data(), bytes.size());
+		ASSERT_NE(nullptr, handle);
+
+		size_t size{};
+		EXPECT_EQ(static_cast<void const*>(bytes.data()),
+		          GetStringsData(handle, &size));
+		EXPECT_EQ(bytes.size(), size);
+
+		auto str = ReadString(handle, 2);
+		auto const data = static_cast<char const*>(GetStringsData(handle, {}));
+		EXPECT_TRUE(str >= data && str < data + size);
+
+		size = 100;
+		EXPECT_EQ(nullptr, GetStringsData(nullptr, &size));
+		EXPECT_EQ(0u, size);
+
+		CloseStrings(handle);
+	}
+
+	TEST_F(lite, misaligned_memory) {
+		auto const bytes = catalog("second");
+		std::vector<std::byte> shifted(bytes.size() + 1);
+		std::copy(bytes.begin(), bytes.end(), shifted.begin() + 1);
+
+		EXPECT_EQ(nullptr,
+		          OpenStringsFromMemory(shifted.data() + 1, bytes.size()));
+	}
+
+	TEST_F(lite, file_handles_share_catalog) {
+		auto const path = write("shared.lng", "second");
+
+		auto first = OpenStrings(path.c_str());
+		auto second = OpenStrings(path.c_str());
+		ASSERT_NE(nullptr, first);
+		ASSERT_NE(nullptr, second);
+		EXPECT_NE(first, second);
+
+		size_t size{};
+		auto const data = GetStringsData(first, &size);
+		EXPECT_EQ(data, GetStringsData(second, {}));
+		EXPECT_EQ(ReadString(first, 2), ReadString(second, 2));
+		EXPECT_EQ(std::filesystem::file_size(path), size);
+
+		// mapped handles do not share the copy of the file
+		auto mapped = OpenStringsMapped(path.c_str());
+		ASSERT_NE(nullptr, mapped);
+		EXPECT_NE(data, GetStringsData(mapped, {}));
+		EXPECT_EQ("second"sv, read(mapped, 2));
+
+		CloseStrings(first);
+		EXPECT_EQ("second"sv, read(second, 2));
+
+		CloseStrings(mapped);
+		CloseStrings(second);
+	}
+
+	TEST_F(lite, replaced_file_gets_new_catalog) {
+		auto const path = write("replaced.lng", "second");
+
+		auto before = OpenStrings(path.c_str());
+		ASSERT_NE(nullptr, before);
+
+		write("replaced.lng", "replaced");
+		auto after = OpenStrings(path.c_str());
+		ASSERT_NE(nullptr, after);
+
+		EXPECT_NE(GetStringsData(before, {}), GetStringsData(after, {}));
+		EXPECT_EQ("second"sv, read(before, 2));
+		EXPECT_EQ("replaced"sv, read(after, 2));
+
+		CloseStrings(before);
+		CloseStrings(after);
+	}
+
+#ifdef __linux__
+	static size_t mappings_of(std::string const& path) {
+		auto const name = std::filesystem::path{path}.filename().string();
+		std::ifstream maps{"/proc/self/maps"};
+		size_t count{};
+		for (std::string line; std::getline(maps, line);) {
+			if (line.find(name) != std::string::npos) ++count;
+		}
+		return count;
+	}
+
+	TEST_F(lite, last_close_unmaps) {
+		auto const path = write("unmapped.lng", "second");
+		ASSERT_EQ(0u, mappings_of(path));
+
+		auto first = OpenStringsMapped(path.c_str());
+		ASSERT_NE(nullptr, first);
+		auto const mapped = mappings_of(path);
+		EXPECT_NE(0u, mapped);
+
+		auto second = OpenStringsMapped(path.c_str());
+		ASSERT_NE(nullptr, second);
+		EXPECT_EQ(GetStringsData(first, {}), GetStringsData(second, {}));
+		EXPECT_EQ(mapped, mappings_of(path));
+
+		CloseStrings(first);
+		EXPECT_EQ(mapped, mappings_of(path));
+		EXPECT_EQ("second"sv, read(second, 2));
+
+		CloseStrings(second);
+		EXPECT_EQ(0u, mappings_of(path));
+	}
+#endif
+}  // namespace lngs::testing
@@ -0,0 +1,252 @@
+#!/usr/bin/env python
+
+# Runs a benchmark executable, or the lngs tool on a synthetic module, and
+# compares the results with a checked-in baseline. Meant to be called by
+# CTest, see libs/liblngs/CMakeLists.txt and app/CMakeLists.txt.
+#
+# Baseline file:
+#
+#   {
+#     "tolerance": {"time": 0.5, "memory": 0.2},
+#     "filter": "<--benchmark_filter regex>",   # bench only
+#     "min_time": 0.1,                          # bench only
+#     "repetitions": 5,
+#     "module": {"strings": 100000, "seed": 7, "lang": "pl"},  # make only
+#     "results": {"<name>": {"<metric>": <value>, ...}, ...}
+#   }
+#
+# Every metric is named after its unit. A result is a regression if it is
+# more than (1 + tolerance) times the baseline; memory counters also get a
+# small absolute slack, so that a path without allocations may not start
+# allocating, but the benchmark library's own, amortized allocations do not
+# count. Timings only mean something on the machine, which recorded them, so
+# they are only reported, unless --check-time (or LNGS_PERF_CHECK_TIME=1 in
+# the environment) asks to gate them as well. A result with no baseline entry
+# fails, so that a stale baseline cannot pass unnoticed; a baseline without
+# any results is skipped (exit code 77), until it is recorded. A result over
+# twice as fast as the baseline is only reported, suggesting a new baseline.
+# Use --update (or LNGS_PERF_UPDATE=1 in the environment) to store the current
+# results as the new baseline.
+
+import argparse
+import json
+import os
+import statistics
+import subprocess
+import sys
+import time
+
+TIME_SCALE = {"ns": 1, "us": 1e3, "ms": 1e6, "s": 1e9}
+SLACK = {"allocs/op": 0.5, "bytes/op": 8, "peak": 256}
+TIMES = ("time_ns", "wall_ms")
+SKIPPED = 77
+
+
+def load_baseline(path):
+    try:
+        with open(path, encoding="UTF-8") as f:
+            return json.load(f)
+    except FileNotFoundError:
+        return {}
+
+
+def store_baseline(path, baseline, results):
+    baseline["results"] = results
+    with open(path, "w", encoding="UTF-8") as f:
+        json.dump(baseline, f, indent=2, sort_keys=True)
+        f.write("\n")
+    print(f"baseline written to {path}")
+
+
+def run_benchmarks(args, baseline):
+    cmd = [
+        args.exe,
+        "--benchmark_format=json",
+        "--benchmark_report_aggregates_only=true",
+        f"--benchmark_repetitions={baseline.get('repetitions', 5)}",
+    ]
+    if "min_time" in baseline:
+        cmd.append(f"--benchmark_min_time={baseline['min_time']}")
+    if "filter" in baseline:
+        cmd.append(f"--benchmark_filter={baseline['filter']}")
+    proc = subprocess.run(cmd, stdout=subprocess.PIPE, check=True)
+    report = json.loads(proc.stdout)
+
+    results = {}
+    for bench in report["benchmarks"]:
+        if bench.get("aggregate_name") != "median":
+            continue
+        scale = TIME_SCALE[bench.get("time_unit", "ns")]
+        metrics = {"time_ns": round(bench["cpu_time"] * scale, 2)}
+        for counter in SLACK:
+            if counter in bench:
+                metrics[counter] = round(bench[counter], 2)
+        results[bench["run_name"]] = metrics
+    return results
+
+
+def peak_rss_kib(usage):
+    # ru_maxrss is in KiB on Linux and in bytes on macOS
+    if sys.platform == "darwin":
+        return usage.ru_maxrss / 1024
+    return usage.ru_maxrss
+
+
+def run_tool(cmd):
+    start = time.perf_counter()
+    if not hasattr(os, "wait4"):
+        subprocess.run(cmd, stdout=subprocess.DEVNULL, check=True)
+        return (time.perf_counter() - start) * 1e3, None
+
+    proc = subprocess.Popen(cmd, stdout=subprocess.DEVNULL)
+    _, status, usage = os.wait4(proc.pid, 0)
+    elapsed = (time.perf_counter() - start) * 1e3
+    proc.returncode = os.waitstatus_to_exitcode(status)
+    if proc.returncode:
+        raise subprocess.CalledProcessError(proc.returncode, cmd)
+    return elapsed, peak_rss_kib(usage)
+
+
+def run_make(args, baseline):
+    module = baseline.get("module", {})
+    lang = module.get("lang", "pl")
+    os.makedirs(args.workdir, exist_ok=True)
+    subprocess.run(
+        [
+            args.exe,
+            "synth",
+            "-o",
+            args.workdir,
+            "-n",
+            str(module.get("strings", 100000)),
+            "--seed",
+            str(module.get("seed", 7)),
+            "-l",
+            lang,
+        ],
+        stdout=subprocess.DEVNULL,
+        check=True,
+    )
+
+    idl = os.path.join(args.workdir, "synth.idl")
+    mo = os.path.join(args.workdir, f"{lang}.mo")
+    lng = os.path.join(args.workdir, f"{lang}.lng")
+    times = []
+    rss = []
+    for _ in range(baseline.get("repetitions", 5)):
+        elapsed, peak = run_tool([args.exe, "make", idl, "-m", mo, "-o", lng])
+        times.append(elapsed)
+        if peak is not None:
+            rss.append(peak)
+
+    metrics = {"wall_ms": round(statistics.median(times), 2)}
+    if rss:
+        metrics["peak_rss_kib"] = max(rss)
+    return {"make": metrics}
+
+
+def limit_for(metric, base, tolerance):
+    if metric in TIMES:
+        return base * (1 + tolerance.get("time", 0.5))
+    return base * (1 + tolerance.get("memory", 0.2)) + SLACK.get(metric, 0)
+
+
+def from_env(name):
+    return os.environ.get(name, "") not in ("", "0")
+
+
+def compare(baseline, results, check_time):
+    tolerance = baseline.get("tolerance", {})
+    expected = baseline.get("results", {})
+    failed = []
+    for name, metrics in sorted(results.items()):
+        known = expected.get(name)
+        if known is None:
+            failed.append(f"{name}: not in the baseline")
+            print(f"  NEW   {name}")
+            continue
+        for metric, value in sorted(metrics.items()):
+            base = known.get(metric)
+            if base is None:
+                continue
+            limit = limit_for(metric, base, tolerance)
+            ratio = value / base if base else float("inf") if value else 1
+            line = f"{name} {metric}: {value:.6g} (baseline {base:.6g}, {ratio:.2f}x)"
+            if metric in TIMES and not check_time:
+                print(f"  TIME  {line}")
+            elif value > limit:
+                failed.append(line)
+                print(f"  SLOW  {line}")
+            elif ratio < 0.5:
+                print(f"  FAST  {line}")
+            else:
+                print(f"  OK    {line}")
+    for name in sorted(expected.keys() - results.keys()):
+        print(f"  GONE  {name}")
+    return failed
+
+
+def main():
+    parser = argparse.ArgumentParser(
+        description="Compare benchmark results with a stored baseline"
+    )
+    parser.add_argument("mode", choices=["bench", "make"], help="what to run")
+    parser.add_argument(
+        "--baseline", metavar="<json>", required=True, help="set the baseline file"
+    )
+    parser.add_argument(
+        "--exe",
+        metavar="<exe>",
+        required=True,
+        help="set the benchmark executable or the lngs tool",
+    )
+    parser.add_argument(
+        "--workdir",
+        metavar="<dir>",
+        default=".",
+        help="set the directory for the synthetic module",
+    )
+    parser.add_argument(
+        "--update",
+        action="store_true",
+        default=from_env("LNGS_PERF_UPDATE"),
+        help="store the results as the new baseline",
+    )
+    parser.add_argument(
+        "--check-time",
+        action="store_true",
+        default=from_env("LNGS_PERF_CHECK_TIME"),
+        help="fail on timings over the baseline, not only on memory",
+    )
+    args = parser.parse_args()
+
+    baseline = load_baseline(args.baseline)
+    if not args.update and not baseline.get("results"):
+        print(f"no results recorded in {args.baseline}, skipping")
+        print("record them with --update (or LNGS_PERF_UPDATE=1)")
+        return SKIPPED
+    if args.mode == "bench":
+        results = run_benchmarks(args, baseline)
+    else:
+        results = run_make(args, baseline)
+
+    if args.update:
+        store_baseline(args.baseline, baseline, results)
+        return 0
+
+    failed = compare(baseline, results, args.check_time)
+    if failed:
+        print(f"{len(failed)} result(s) failed the baseline:", file=sys.stderr)
+        for line in failed:
+            print(f"  {line}", file=sys.stderr)
+        print(
+            "if the results are expected, store them with --update "
+            "(or LNGS_PERF_UPDATE=1)",
+            file=sys.stderr,
+        )
+        return 1
+    return 0
+
+
+if __name__ == "__main__":
+    sys.exit(main())